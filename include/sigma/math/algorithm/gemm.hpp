@@ -0,0 +1,354 @@
+#ifndef		_SIGMA_API_MATH_ALGORITHM_GEMM_HPP_
+#define		_SIGMA_API_MATH_ALGORITHM_GEMM_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../simd/pack.hpp"
+
+namespace sigma::math
+{
+	//	Cache blocked row-major matrix multiply, C += A * B with A m x k, B k x n.
+	//	A blocking is a VVector<mr, nr, mc, kc, nc>:
+	//		mr x nr		register tile computed by the micro-kernel, nr in elements
+	//		mc x kc		block of A packed to stay in L2
+	//		kc x nc		panel of B packed to stay in L3, kc x nr slivers in L1
+
+	template <std::size_t mr_, std::size_t nr_, std::size_t mc_, std::size_t kc_, std::size_t nc_>
+	using Blocking = meta::VVector<mr_, nr_, mc_, kc_, nc_>;
+
+	//	candidates scale with the pack width, they differ in tile shape and in
+	//	how much of each cache level a block claims
+
+	template <typename Type_>
+	inline constexpr auto gemm_candidates(meta::Type<Type_>)
+	{
+		constexpr std::size_t width = native_pack_t<Type_>::width;
+		return meta::TVector<
+			Blocking<4, 2 * width, 128, 256, 2048>,
+			Blocking<6, 2 * width, 96, 256, 2048>,
+			Blocking<8, 2 * width, 96, 192, 4096>,
+			Blocking<4, 3 * width, 64, 256, 3072>,
+			Blocking<8, width, 128, 384, 2048>>{};
+	}
+
+	template <typename Type_>
+	inline constexpr auto default_blocking(meta::Type<Type_>)
+	{
+		constexpr std::size_t width = native_pack_t<Type_>::width;
+		return Blocking<6, 2 * width, 96, 256, 2048>{};
+	}
+
+	//	exact overloads from the tuned header win over this fallback, they are
+	//	tagged with the isa they were timed on since the tile width is a multiple
+	//	of its pack width, a build for another isa keeps the default
+
+	template <typename Type_, typename Isa_>
+	inline constexpr auto tuned_blocking(meta::Type<Type_> type, meta::Type<Isa_>) { return default_blocking(type); }
+}
+
+//	blocking overloads written by the autotuner, see write_tuned_header
+
+#if __has_include("gemm_tuned.hpp")
+#include "gemm_tuned.hpp"
+#endif
+
+namespace sigma::math
+{
+	template <typename Type_>
+	inline constexpr auto blocking(meta::Type<Type_> type)
+	{ return tuned_blocking(type, meta::type_c<typename decltype(select_isa(type))::type_t>); }
+
+	namespace detail
+	{
+		template <typename Type_>
+		inline std::vector<Type_> & gemm_buffer(std::size_t index, std::size_t size)
+		{
+			thread_local std::vector<Type_> buffers[2];
+			if (buffers[index].size() < size) buffers[index].resize(size);
+			return buffers[index];
+		}
+
+		//	rows of A into mr-row slivers, column-interleaved: sliver[p * mr + i]
+
+		template <std::size_t mr_, typename Type_>
+		inline void pack_a(std::size_t rows, std::size_t depth, const Type_ * a, std::size_t lda, Type_ * packed)
+		{
+			for (std::size_t row = 0; row < rows; row += mr_)
+			{
+				const std::size_t height = std::min(mr_, rows - row);
+				for (std::size_t p = 0; p < depth; ++p)
+				{
+					for (std::size_t i = 0; i < height; ++i) packed[i] = a[(row + i) * lda + p];
+					for (std::size_t i = height; i < mr_; ++i) packed[i] = Type_{};
+					packed += mr_;
+				}
+			}
+		}
+
+		//	columns of B into nr-column slivers, row-interleaved: sliver[p * nr + j]
+
+		template <std::size_t nr_, typename Type_>
+		inline void pack_b(std::size_t depth, std::size_t columns, const Type_ * b, std::size_t ldb, Type_ * packed)
+		{
+			for (std::size_t column = 0; column < columns; column += nr_)
+			{
+				const std::size_t width = std::min(nr_, columns - column);
+				for (std::size_t p = 0; p < depth; ++p)
+				{
+					const Type_ * source = b + p * ldb + column;
+					for (std::size_t j = 0; j < width; ++j) packed[j] = source[j];
+					for (std::size_t j = width; j < nr_; ++j) packed[j] = Type_{};
+					packed += nr_;
+				}
+			}
+		}
+
+		//	calls function(i) for every i of the sequence as straight-line code,
+		//	plain loops are left rolled at -O2 which spills the accumulators
+
+		template <typename Function_, std::size_t... indices_>
+		inline void unroll(std::index_sequence<indices_...>, Function_ && function)
+		{ (function(indices_), ...); }
+
+		//	mr x nr accumulators live in registers for the whole depth,
+		//	each step is nr / width loads of B, mr broadcasts of A and the fmas
+
+		template <std::size_t mr_, std::size_t nr_, typename Pack_, typename Type_>
+		inline void micro_kernel(std::size_t depth, const Type_ * a, const Type_ * b,
+			Type_ * c, std::size_t ldc, std::size_t rows, std::size_t columns)
+		{
+			constexpr std::size_t packs = nr_ / Pack_::width;
+			constexpr auto tile_rows = std::make_index_sequence<mr_>{};
+			constexpr auto tile_packs = std::make_index_sequence<packs>{};
+
+			Pack_ accumulators[mr_][packs];
+			unroll(tile_rows, [&](std::size_t i) {
+				unroll(tile_packs, [&](std::size_t j) { accumulators[i][j] = Pack_::zero(); });
+			});
+
+			for (std::size_t p = 0; p < depth; ++p, a += mr_, b += nr_)
+			{
+				Pack_ columns_b[packs];
+				unroll(tile_packs, [&](std::size_t j) { columns_b[j] = Pack_::load(b + j * Pack_::width); });
+
+				unroll(tile_rows, [&](std::size_t i) {
+					const Pack_ scalar = Pack_::broadcast(a[i]);
+					unroll(tile_packs, [&](std::size_t j) {
+						accumulators[i][j] = fma(scalar, columns_b[j], accumulators[i][j]);
+					});
+				});
+			}
+
+			if (rows == mr_ && columns == nr_)
+			{
+				unroll(tile_rows, [&](std::size_t i) {
+					unroll(tile_packs, [&](std::size_t j) {
+						Type_ * target = c + i * ldc + j * Pack_::width;
+						(Pack_::load(target) + accumulators[i][j]).store(target);
+					});
+				});
+			}
+			else
+			{
+				Type_ tile[mr_ * nr_];
+				unroll(tile_rows, [&](std::size_t i) {
+					unroll(tile_packs, [&](std::size_t j) { accumulators[i][j].store(tile + i * nr_ + j * Pack_::width); });
+				});
+
+				for (std::size_t i = 0; i < rows; ++i)
+					for (std::size_t j = 0; j < columns; ++j)
+						c[i * ldc + j] += tile[i * nr_ + j];
+			}
+		}
+	}
+
+	template <std::size_t mr_, std::size_t nr_, std::size_t mc_, std::size_t kc_, std::size_t nc_, typename Type_>
+	inline void gemm(Blocking<mr_, nr_, mc_, kc_, nc_>, std::size_t m, std::size_t n, std::size_t k,
+		const Type_ * a, std::size_t lda, const Type_ * b, std::size_t ldb, Type_ * c, std::size_t ldc)
+	{
+		using pack_t = native_pack_t<Type_>;
+
+		static_assert(mr_ != 0 && nr_ != 0 && kc_ != 0, "gemm blocking requires a non-empty tile");
+		static_assert(nr_ % pack_t::width == 0, "gemm tile width must be a multiple of the pack width");
+		static_assert(mc_ % mr_ == 0 && nc_ % nr_ == 0, "gemm blocks must be whole tiles");
+
+		Type_ * packed_a = detail::gemm_buffer<Type_>(0, mc_ * kc_).data();
+		Type_ * packed_b = detail::gemm_buffer<Type_>(1, kc_ * nc_).data();
+
+		for (std::size_t jc = 0; jc < n; jc += nc_)
+		{
+			const std::size_t nc = std::min(nc_, n - jc);
+
+			for (std::size_t pc = 0; pc < k; pc += kc_)
+			{
+				const std::size_t kc = std::min(kc_, k - pc);
+				detail::pack_b<nr_>(kc, nc, b + pc * ldb + jc, ldb, packed_b);
+
+				for (std::size_t ic = 0; ic < m; ic += mc_)
+				{
+					const std::size_t mc = std::min(mc_, m - ic);
+					detail::pack_a<mr_>(mc, kc, a + ic * lda + pc, lda, packed_a);
+
+					for (std::size_t jr = 0; jr < nc; jr += nr_)
+						for (std::size_t ir = 0; ir < mc; ir += mr_)
+							detail::micro_kernel<mr_, nr_, pack_t>(kc,
+								packed_a + ir * kc, packed_b + jr * kc,
+								c + (ic + ir) * ldc + jc + jr, ldc,
+								std::min(mr_, mc - ir), std::min(nr_, nc - jr));
+				}
+			}
+		}
+	}
+
+	//	dense operands with leading dimensions equal to their widths
+
+	template <typename Blocking_, typename Type_>
+	inline void gemm(Blocking_ blocking, std::size_t m, std::size_t n, std::size_t k,
+		const Type_ * a, const Type_ * b, Type_ * c)
+	{ gemm(blocking, m, n, k, a, k, b, n, c, n); }
+
+	template <typename Type_>
+	inline void gemm(std::size_t m, std::size_t n, std::size_t k, const Type_ * a, const Type_ * b, Type_ * c)
+	{ gemm(blocking(meta::type_c<Type_>), m, n, k, a, k, b, n, c, n); }
+
+	//*******************************************
+	//			autotuning
+	//*******************************************
+
+	struct GemmTiming
+	{
+		std::size_t candidate;
+		double seconds;
+	};
+
+	namespace detail
+	{
+		template <typename Blocking_, typename Type_>
+		inline double time_gemm(Blocking_ blocking, std::size_t size, std::size_t repeats,
+			const std::vector<Type_> & a, const std::vector<Type_> & b, std::vector<Type_> & c)
+		{
+			gemm(blocking, size, size, size, a.data(), b.data(), c.data());
+
+			double best = 0;
+			for (std::size_t repeat = 0; repeat < repeats; ++repeat)
+			{
+				const auto start = std::chrono::steady_clock::now();
+				gemm(blocking, size, size, size, a.data(), b.data(), c.data());
+				const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+				if (repeat == 0 || elapsed.count() < best) best = elapsed.count();
+			}
+			return best;
+		}
+
+		template <typename... Blockings_, typename Type_, std::size_t... indices_>
+		inline std::vector<GemmTiming> time_candidates(meta::TVector<Blockings_...>, std::size_t size,
+			std::size_t repeats, const std::vector<Type_> & a, const std::vector<Type_> & b,
+			std::vector<Type_> & c, std::index_sequence<indices_...>)
+		{ return { GemmTiming{ indices_, time_gemm(Blockings_{}, size, repeats, a, b, c) }... }; }
+	}
+
+	//	times every candidate on the host over square matrices of each size,
+	//	returning the total of the per-size best times per candidate
+
+	template <typename Type_, typename... Blockings_>
+	inline std::vector<GemmTiming> autotune(meta::TVector<Blockings_...> candidates,
+		const std::vector<std::size_t> & sizes, std::size_t repeats = 5)
+	{
+		std::vector<GemmTiming> totals;
+		for (std::size_t index = 0; index < sizeof...(Blockings_); ++index) totals.push_back({ index, 0 });
+
+		for (std::size_t size : sizes)
+		{
+			std::vector<Type_> a(size * size), b(size * size), c(size * size);
+			for (std::size_t index = 0; index < a.size(); ++index)
+			{
+				a[index] = static_cast<Type_>(index % 13) / 13;
+				b[index] = static_cast<Type_>(index % 7) / 7;
+			}
+
+			for (const auto & timing : detail::time_candidates(candidates, size, repeats, a, b, c,
+				std::index_sequence_for<Blockings_...>{}))
+				totals[timing.candidate].seconds += timing.seconds;
+		}
+
+		return totals;
+	}
+
+	namespace detail
+	{
+		template <typename... Blockings_, std::size_t... indices_>
+		inline std::string blocking_name(meta::TVector<Blockings_...>, std::size_t candidate, std::index_sequence<indices_...>)
+		{
+			const std::string names[] = { [](auto blocking)
+			{
+				return "Blocking<" + std::to_string(blocking.template get<0>()) + ", "
+					+ std::to_string(blocking.template get<1>()) + ", "
+					+ std::to_string(blocking.template get<2>()) + ", "
+					+ std::to_string(blocking.template get<3>()) + ", "
+					+ std::to_string(blocking.template get<4>()) + ">";
+			}(Blockings_{})... };
+			return names[candidate];
+		}
+
+		inline std::string isa_name(meta::Type<isa::Scalar>) { return "isa::Scalar"; }
+		inline std::string isa_name(meta::Type<isa::SSE>) { return "isa::SSE"; }
+		inline std::string isa_name(meta::Type<isa::AVX2>) { return "isa::AVX2"; }
+		inline std::string isa_name(meta::Type<isa::AVX512>) { return "isa::AVX512"; }
+
+		template <typename Type_>
+		inline std::string tune_type(const std::vector<std::size_t> & sizes, std::size_t repeats, const char * type_name)
+		{
+			constexpr auto candidates = gemm_candidates(meta::type_c<Type_>);
+			const auto timings = autotune<Type_>(candidates, sizes, repeats);
+			const auto best = std::min_element(timings.begin(), timings.end(),
+				[](const GemmTiming & lhs, const GemmTiming & rhs) { return lhs.seconds < rhs.seconds; });
+
+			return "\tinline constexpr auto tuned_blocking(meta::Type<" + std::string(type_name) + ">, meta::Type<"
+				+ isa_name(meta::type_c<typename decltype(select_isa(meta::type_c<Type_>))::type_t>) + ">)\n\t{ return "
+				+ blocking_name(candidates, best->candidate, std::make_index_sequence<candidates.size()>{}) + "{}; }\n";
+		}
+	}
+
+	//	tunes float and double and writes the winners as tuned_blocking overloads,
+	//	placing the file next to this header as gemm_tuned.hpp makes later builds
+	//	pick it up. The text is complete before anything is written and replaces
+	//	path through a rename, so a failed or interrupted run keeps the old file
+
+	inline bool write_tuned_header(const std::string & path,
+		const std::vector<std::size_t> & sizes = { 64, 256, 512, 1024 }, std::size_t repeats = 3)
+	{
+		const std::string text = "#ifndef\t\t_SIGMA_API_MATH_ALGORITHM_GEMM_TUNED_HPP_\n"
+			"#define\t\t_SIGMA_API_MATH_ALGORITHM_GEMM_TUNED_HPP_\n\n"
+			"//\tgenerated by sigma::math::write_tuned_header, do not edit\n\n"
+			"namespace sigma::math\n{\n"
+			+ detail::tune_type<float>(sizes, repeats, "float") + "\n"
+			+ detail::tune_type<double>(sizes, repeats, "double")
+			+ "}\n\n#endif\t//\t_SIGMA_API_MATH_ALGORITHM_GEMM_TUNED_HPP_\n";
+
+		const std::string temporary = path + ".tmp";
+		{
+			std::ofstream file(temporary);
+			if (!(file << text) || !file.flush())
+			{
+				file.close();
+				std::remove(temporary.c_str());
+				return false;
+			}
+		}
+
+		if (std::rename(temporary.c_str(), path.c_str()) != 0)
+		{
+			std::remove(temporary.c_str());
+			return false;
+		}
+		return true;
+	}
+}
+
+#endif	//	_SIGMA_API_MATH_ALGORITHM_GEMM_HPP_
\ No newline at end of file
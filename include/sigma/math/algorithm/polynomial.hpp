@@ -0,0 +1,255 @@
+#ifndef		_SIGMA_API_MATH_ALGORITHM_POLYNOMIAL_HPP_
+#define		_SIGMA_API_MATH_ALGORITHM_POLYNOMIAL_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include "../simd/pack.hpp"
+
+namespace sigma::math
+{
+	//*******************************************
+	//			coefficient storage
+	//*******************************************
+
+	//	floating point values cannot be template arguments, coefficients are
+	//	kept in VVectors as the bit patterns of the target type
+
+	template <typename Type_>
+	using bits_t = std::conditional_t<sizeof(Type_) == 8, std::uint64_t, std::uint32_t>;
+
+	template <typename Type_>
+	inline constexpr bits_t<Type_> to_bits(Type_ value) { return __builtin_bit_cast(bits_t<Type_>, value); }
+
+	template <typename Type_>
+	inline constexpr Type_ from_bits(bits_t<Type_> bits) { return __builtin_bit_cast(Type_, bits); }
+
+	//*******************************************
+	//			evaluation
+	//*******************************************
+
+	//	c0 + x * (c1 + x * (c2 + ...)), one fma per coefficient in sequence
+
+	template <typename Pack_, auto first_, auto... trail_>
+	inline constexpr Pack_ horner(meta::VVector<first_, trail_...>, Pack_ x)
+	{
+		const auto constant = Pack_::broadcast(from_bits<typename Pack_::value_t>(first_));
+		if constexpr (sizeof...(trail_) == 0) return constant;
+		else return fma(horner(meta::VVector<trail_...>{}, x), x, constant);
+	}
+
+	namespace detail
+	{
+		//	(c0 + c1 x) + x^2 (c2 + c3 x) + ..., pairs are independent so the
+		//	dependency chain is log2 of the degree instead of the degree
+
+		template <typename Pack_, std::size_t size_, std::size_t... indices_>
+		inline constexpr std::array<Pack_, (size_ + 1) / 2> estrin_pairs(const std::array<Pack_, size_> & terms,
+			Pack_ x, std::index_sequence<indices_...>)
+		{
+			return { { (2 * indices_ + 1 < size_
+				? fma(terms[(2 * indices_ + 1) % size_], x, terms[2 * indices_])
+				: terms[2 * indices_])... } };
+		}
+
+		template <typename Pack_, std::size_t size_>
+		inline constexpr Pack_ estrin(const std::array<Pack_, size_> & terms, Pack_ x)
+		{
+			if constexpr (size_ == 1) return terms[0];
+			else return estrin(estrin_pairs(terms, x, std::make_index_sequence<(size_ + 1) / 2>{}), x * x);
+		}
+	}
+
+	template <typename Pack_, auto... bits_>
+	inline constexpr Pack_ estrin(meta::VVector<bits_...>, Pack_ x)
+	{
+		static_assert(sizeof...(bits_) != 0, "cannot evaluate a polynomial without coefficients");
+		using value_t = typename Pack_::value_t;
+		return detail::estrin(std::array<Pack_, sizeof...(bits_)>{ { Pack_::broadcast(from_bits<value_t>(bits_))... } }, x);
+	}
+
+	//*******************************************
+	//			accuracy tiers
+	//*******************************************
+
+	namespace accuracy
+	{
+		struct Low {};
+		struct Medium {};
+		struct Full {};
+	}
+
+	//	relative error targeted by each tier, Full is the epsilon of the type
+
+	template <typename Type_>
+	inline constexpr long double tolerance(meta::Type<accuracy::Low>, meta::Type<Type_>) { return 1e-4L; }
+
+	template <typename Type_>
+	inline constexpr long double tolerance(meta::Type<accuracy::Medium>, meta::Type<Type_>)
+	{ return std::numeric_limits<Type_>::epsilon() < 1e-7L ? 1e-7L : std::numeric_limits<Type_>::epsilon(); }
+
+	template <typename Type_>
+	inline constexpr long double tolerance(meta::Type<accuracy::Full>, meta::Type<Type_>)
+	{ return std::numeric_limits<Type_>::epsilon(); }
+
+	//*******************************************
+	//			chebyshev fitting
+	//*******************************************
+
+	//	A kernel is a function approximated over an interval:
+	//		lower, upper				static constexpr long double bounds
+	//		evaluate(x)					static constexpr long double reference
+	//	it is interpolated at Chebyshev nodes entirely at compile time, the
+	//	series is truncated to the lowest degree meeting the tolerance and
+	//	rewritten as monomials in t = x * scale + offset, t in [-1, 1]
+
+	inline constexpr std::size_t chebyshev_nodes = 64;
+
+	namespace detail
+	{
+		inline constexpr long double pi = 3.141592653589793238462643383279502884L;
+
+		inline constexpr long double absolute(long double value) { return value < 0 ? -value : value; }
+
+		//	node angles lie in [0, pi], the series is exact to long double there
+		inline constexpr long double cosine(long double angle)
+		{
+			long double result = 1, term = 1;
+			for (int index = 1; index < 40; ++index)
+			{
+				term *= -angle * angle / ((2 * index - 1) * (2 * index));
+				result += term;
+			}
+			return result;
+		}
+
+		struct Chebyshev
+		{
+			std::array<long double, chebyshev_nodes> coefficients;
+			long double magnitude;		//	smallest |f| over the nodes
+		};
+
+		template <typename Kernel_>
+		inline constexpr Chebyshev chebyshev(void)
+		{
+			constexpr long double centre = (Kernel_::upper + Kernel_::lower) / 2;
+			constexpr long double radius = (Kernel_::upper - Kernel_::lower) / 2;
+
+			Chebyshev result{};
+			std::array<long double, chebyshev_nodes> nodes{}, values{};
+
+			for (std::size_t node = 0; node < chebyshev_nodes; ++node)
+			{
+				nodes[node] = cosine(pi * (node + 0.5L) / chebyshev_nodes);
+				values[node] = Kernel_::evaluate(centre + radius * nodes[node]);
+
+				const long double magnitude = absolute(values[node]);
+				if (node == 0 || magnitude < result.magnitude) result.magnitude = magnitude;
+			}
+
+			//	c_k = 2 / N * sum f(x_j) T_k(x_j), halved for k = 0
+			for (std::size_t node = 0; node < chebyshev_nodes; ++node)
+			{
+				long double previous = 1, current = nodes[node];
+				result.coefficients[0] += values[node] / chebyshev_nodes;
+				for (std::size_t order = 1; order < chebyshev_nodes; ++order)
+				{
+					result.coefficients[order] += 2 * values[node] * current / chebyshev_nodes;
+					const long double next = 2 * nodes[node] * current - previous;
+					previous = current;
+					current = next;
+				}
+			}
+
+			return result;
+		}
+
+		template <typename Kernel_>
+		inline constexpr Chebyshev chebyshev_v = chebyshev<Kernel_>();
+
+		//	lowest degree whose discarded tail is within the tolerance,
+		//	leaving headroom for the rounding of the evaluation; coefficients
+		//	at the rounding noise of the interpolation itself are not counted
+
+		template <typename Kernel_>
+		inline constexpr std::size_t degree(long double tolerance)
+		{
+			const auto & series = chebyshev_v<Kernel_>;
+			const long double noise = 64 * std::numeric_limits<long double>::epsilon() * absolute(series.coefficients[0]);
+
+			long double tail = 0;
+			std::size_t result = chebyshev_nodes / 2;
+			for (; result > 0; --result)
+			{
+				if (absolute(series.coefficients[result]) > noise) tail += absolute(series.coefficients[result]);
+				if (tail > tolerance * series.magnitude / 4) break;
+			}
+			return result;
+		}
+
+		template <typename Kernel_, typename Type_, typename Accuracy_>
+		inline constexpr std::size_t checked_degree(void)
+		{
+			constexpr std::size_t result = degree<Kernel_>(tolerance(meta::type_c<Accuracy_>, meta::type_c<Type_>));
+			static_assert(result < chebyshev_nodes / 2, "kernel does not converge to the tolerance, narrow its interval");
+			return result;
+		}
+
+		template <typename Kernel_, typename Type_, typename Accuracy_>
+		inline constexpr std::size_t degree_v = checked_degree<Kernel_, Type_, Accuracy_>();
+
+		//	sum c_k T_k(t) expanded with T_k+1 = 2t T_k - T_k-1
+
+		template <std::size_t size_>
+		inline constexpr std::array<long double, size_> monomials(const std::array<long double, chebyshev_nodes> & series)
+		{
+			std::array<long double, size_> result{}, previous{}, current{}, next{};
+			previous[0] = 1;
+			result[0] = series[0];
+			if constexpr (size_ > 1)
+			{
+				current[1] = 1;
+				for (std::size_t order = 1; order < size_; ++order)
+				{
+					for (std::size_t power = 0; power < size_; ++power) result[power] += series[order] * current[power];
+					for (std::size_t power = 0; power < size_; ++power)
+						next[power] = (power ? 2 * current[power - 1] : 0) - previous[power];
+					previous = current;
+					current = next;
+				}
+			}
+			return result;
+		}
+
+		template <typename Kernel_, typename Type_, std::size_t... indices_>
+		inline constexpr auto polynomial(std::index_sequence<indices_...>)
+		{
+			constexpr auto coefficients = monomials<sizeof...(indices_)>(chebyshev_v<Kernel_>.coefficients);
+			return meta::VVector<to_bits(static_cast<Type_>(coefficients[indices_]))...>{};
+		}
+	}
+
+	//	monomial coefficients in t of the fit of Kernel_ for Type_ at Accuracy_
+
+	template <typename Kernel_, typename Type_, typename Accuracy_>
+	inline constexpr auto polynomial_v = detail::polynomial<Kernel_, Type_>(
+		std::make_index_sequence<detail::degree_v<Kernel_, Type_, Accuracy_> + 1>{});
+
+	//	evaluates the fit at x, mapping the kernel interval onto [-1, 1]
+
+	template <typename Kernel_, typename Accuracy_, typename Pack_>
+	inline constexpr Pack_ approximate(meta::Type<Kernel_>, meta::Type<Accuracy_>, Pack_ x)
+	{
+		using value_t = typename Pack_::value_t;
+
+		constexpr auto scale = static_cast<value_t>(2 / (Kernel_::upper - Kernel_::lower));
+		constexpr auto offset = static_cast<value_t>(-(Kernel_::upper + Kernel_::lower) / (Kernel_::upper - Kernel_::lower));
+
+		return estrin(polynomial_v<Kernel_, value_t, Accuracy_>,
+			fma(x, Pack_::broadcast(scale), Pack_::broadcast(offset)));
+	}
+}
+
+#endif	//	_SIGMA_API_MATH_ALGORITHM_POLYNOMIAL_HPP_
\ No newline at end of file
@@ -0,0 +1,489 @@
+#ifndef		_SIGMA_API_MATH_ALGORITHM_TRANSCENDENTAL_HPP_
+#define		_SIGMA_API_MATH_ALGORITHM_TRANSCENDENTAL_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include "polynomial.hpp"
+#include "../container/expression.hpp"
+
+namespace sigma::math
+{
+	//	Packed exp, log, sin, cos and erf. Each reduces its argument to a small
+	//	interval, evaluates a compile time Chebyshev fit there with Estrin's
+	//	scheme and reconstructs the result with bit operations on the lanes.
+	//	The Accuracy_ tier only changes the polynomial degrees:
+	//		Low		1e-4 relative error
+	//		Medium	1e-7 relative error, a few ulp for float
+	//		Full	a few ulp of the type
+	//	sin and cos errors are absolute. Results below about twice the smallest
+	//	normal flush to zero, subnormal arguments of log are handled exactly.
+
+	namespace detail
+	{
+		//	nearest long doubles and their residuals to the true values
+		inline constexpr long double ln2 = 0.693147180559945309417232121458176568L;
+		inline constexpr long double ln2_residual = -1.145835272679873281093529986196612039e-20L;
+		inline constexpr long double pi_2 = 1.570796326794896619231321691639751442L;
+		inline constexpr long double pi_2_residual = -2.508278806334166011778663540165378507e-20L;
+		inline constexpr long double log2e = 1.442695040888963407359924681001892137L;
+		inline constexpr long double sqrt2 = 1.414213562373095048801688724209698079L;
+		inline constexpr long double two_over_sqrt_pi = 1.128379167095512573896158903121545172L;
+
+		//		**	REFERENCES **
+
+		//	long double series for the kernels, only ever constant evaluated
+
+		inline constexpr long double exp_series(long double x)
+		{
+			long double result = 1, term = 1;
+			for (int index = 1; index < 60 && term != 0; ++index)
+			{
+				term *= x / index;
+				result += term;
+			}
+			return result;
+		}
+
+		//	e^x for large |x| by squaring a reduced series, for the erf cutoff
+		inline constexpr long double exp_reference(long double x)
+		{
+			int squarings = 0;
+			for (; absolute(x) > 0.5L; ++squarings) x /= 2;
+
+			long double result = exp_series(x);
+			for (; squarings > 0; --squarings) result *= result;
+			return result;
+		}
+
+		//	e^x^2 erfc(x) for x >= 1 by its continued fraction
+		inline constexpr long double erfcx_reference(long double x)
+		{
+			long double fraction = x;
+			for (int index = 400; index > 0; --index) fraction = x + (index / 2.0L) / fraction;
+			return 1 / (fraction * 1.772453850905516027298167483341145183L);
+		}
+
+		//		**	KERNELS **
+
+		//	e^x on [-ln2 / 2, ln2 / 2]
+		struct ExpKernel
+		{
+			static constexpr long double lower = -ln2 / 2;
+			static constexpr long double upper = ln2 / 2;
+			static constexpr long double evaluate(long double x) { return exp_series(x); }
+		};
+
+		//	atanh(sqrt(u)) / sqrt(u) for u = s^2, s = (m - 1) / (m + 1), m in [1 / sqrt2, sqrt2]
+		struct LogKernel
+		{
+			static constexpr long double lower = 0;
+			static constexpr long double upper = (sqrt2 - 1) * (sqrt2 - 1) / ((sqrt2 + 1) * (sqrt2 + 1));
+			static constexpr long double evaluate(long double u)
+			{
+				long double result = 0, power = 1;
+				for (int index = 0; index < 40; ++index, power *= u) result += power / (2 * index + 1);
+				return result;
+			}
+		};
+
+		//	sin(sqrt(u)) / sqrt(u) and cos(sqrt(u)) for u = r^2, r in [-pi / 4, pi / 4]
+		struct SinKernel
+		{
+			static constexpr long double lower = 0;
+			static constexpr long double upper = pi * pi / 16;
+			static constexpr long double evaluate(long double u)
+			{
+				long double result = 1, term = 1;
+				for (int index = 1; index < 30; ++index)
+				{
+					term *= -u / ((2 * index) * (2 * index + 1));
+					result += term;
+				}
+				return result;
+			}
+		};
+
+		struct CosKernel
+		{
+			static constexpr long double lower = 0;
+			static constexpr long double upper = pi * pi / 16;
+			static constexpr long double evaluate(long double u)
+			{
+				long double result = 1, term = 1;
+				for (int index = 1; index < 30; ++index)
+				{
+					term *= -u / ((2 * index - 1) * (2 * index));
+					result += term;
+				}
+				return result;
+			}
+		};
+
+		//	erf(sqrt(u)) / sqrt(u) for u = x^2, |x| < 1
+		struct ErfKernel
+		{
+			static constexpr long double lower = 0;
+			static constexpr long double upper = 1;
+			static constexpr long double evaluate(long double u)
+			{
+				long double result = 1, term = 1;
+				for (int index = 1; index < 40; ++index)
+				{
+					term *= -u / index;
+					result += term / (2 * index + 1);
+				}
+				return two_over_sqrt_pi * result;
+			}
+		};
+
+		//	first quarter past 1 where erfc drops below the tolerance, erf is 1 beyond
+		inline constexpr long double erf_cutoff(long double tolerance)
+		{
+			long double x = 1.25L;
+			for (; erfcx_reference(x) / exp_reference(x * x) > tolerance / 4; x += 0.25L) {}
+			return x;
+		}
+
+		//	e^x^2 erfc(x) on [1, cutoff]
+		template <typename Type_, typename Accuracy_>
+		struct ErfcKernel
+		{
+			static constexpr long double lower = 1;
+			static constexpr long double upper = erf_cutoff(tolerance(meta::type_c<Accuracy_>, meta::type_c<Type_>));
+			static constexpr long double evaluate(long double x) { return erfcx_reference(x); }
+		};
+
+		//		**	LANE ARITHMETIC **
+
+		//	layout of the floating point type, e.g. 23 explicit mantissa bits
+		//	and a bias of 127 for float
+
+		template <typename Type_>
+		inline constexpr std::size_t mantissa_bits = std::numeric_limits<Type_>::digits - 1;
+
+		template <typename Type_>
+		inline constexpr long double exponent_bias = std::numeric_limits<Type_>::max_exponent - 1;
+
+		template <typename Type_>
+		inline constexpr std::integral_constant<std::size_t, mantissa_bits<Type_>> mantissa_shift{};
+
+		//	value rounded to the type keeping only its leading bits, products
+		//	with small integers are then exact
+		template <typename Type_>
+		inline constexpr Type_ leading(long double value, int bits)
+		{
+			if (value == 0) return 0;
+
+			long double scale = 1;
+			for (; absolute(value) * scale < (1LL << bits); scale *= 2) {}
+			for (; absolute(value) * scale >= (1LL << (bits + 1)); scale /= 2) {}
+			return static_cast<Type_>(static_cast<long long>(value * scale) / scale);
+		}
+
+		//	Cody-Waite constant, value + residual = hi + mid + lo where the
+		//	products of hi and mid with integers below 2^12 are exact even
+		//	without a fused multiply add; rest is everything past hi
+		template <typename Type_>
+		struct Split
+		{
+			static constexpr int bits = std::numeric_limits<Type_>::digits - 12;
+
+			Type_ hi, mid, lo, rest;
+
+			constexpr Split(long double value, long double residual)
+				: hi(leading<Type_>(value, bits)), mid(leading<Type_>(value - hi, bits)),
+				lo(static_cast<Type_>(value - hi - mid + residual)), rest(static_cast<Type_>(value - hi + residual))
+			{}
+		};
+
+		//	x rounded to the nearest integer, valid while |x| < 2^mantissa_bits / 2;
+		//	the low bits of x + magic hold that integer in two's complement
+		template <typename Pack_>
+		inline constexpr Pack_ round_magic(void)
+		{
+			using value_t = typename Pack_::value_t;
+			return Pack_::broadcast(static_cast<value_t>(1.5L * (1ULL << mantissa_bits<value_t>)));
+		}
+
+		template <typename Pack_>
+		inline constexpr Pack_ sign_mask(void) { return Pack_::broadcast(typename Pack_::value_t(-0.0)); }
+
+		template <typename Pack_>
+		inline constexpr Pack_ absolute(Pack_ x) { return andnot(sign_mask<Pack_>(), x); }
+
+		//	2^n for integral n with n + bias in [0, 2^mantissa_bits), writing the
+		//	biased exponent straight into the exponent field; a biased exponent
+		//	of 0 gives zero and an all ones one infinity
+		template <typename Pack_>
+		inline constexpr Pack_ exp2_integral(Pack_ n)
+		{
+			using value_t = typename Pack_::value_t;
+			constexpr auto base = static_cast<value_t>((1ULL << mantissa_bits<value_t>) + exponent_bias<value_t>);
+			return shift_left(n + Pack_::broadcast(base), mantissa_shift<value_t>);
+		}
+
+		template <typename Accuracy_, typename Pack_>
+		inline constexpr Pack_ exp(Pack_ x)
+		{
+			using value_t = typename Pack_::value_t;
+
+			constexpr auto bias = exponent_bias<value_t>;
+			constexpr Split<value_t> ln2_split(ln2, ln2_residual);
+
+			//	past the upper bound the result is infinite, past the lower zero
+			const Pack_ clamped = max(min(x, Pack_::broadcast(static_cast<value_t>((bias + 2) * ln2))),
+				Pack_::broadcast(static_cast<value_t>(-(bias - 1) * ln2)));
+
+			//	x = n ln2 + r, |r| <= ln2 / 2
+			const Pack_ n = fma(clamped, Pack_::broadcast(static_cast<value_t>(log2e)), round_magic<Pack_>()) - round_magic<Pack_>();
+			Pack_ r = fma(n, Pack_::broadcast(-ln2_split.hi), clamped);
+			r = fma(n, Pack_::broadcast(-ln2_split.rest), r);
+
+			//	2^n is taken as 2 * 2^(n - 1) so that n = bias + 1 is still finite,
+			//	n = bias + 2 fills the exponent field and gives infinity
+			const Pack_ polynomial = approximate(meta::type_c<ExpKernel>, meta::type_c<Accuracy_>, r);
+			const Pack_ result = (polynomial + polynomial) * exp2_integral(n - Pack_::broadcast(value_t(1)));
+
+			return select(equal(x, x), result, x);
+		}
+
+		template <typename Accuracy_, typename Pack_>
+		inline constexpr Pack_ log(Pack_ x)
+		{
+			using value_t = typename Pack_::value_t;
+
+			constexpr auto mantissa = mantissa_bits<value_t>;
+			constexpr Split<value_t> ln2_split(ln2, ln2_residual);
+
+			const Pack_ one = Pack_::broadcast(value_t(1));
+			const Pack_ zero = Pack_::zero();
+			const Pack_ infinity = Pack_::broadcast(std::numeric_limits<value_t>::infinity());
+
+			//	subnormals are scaled into the normal range first
+			const Pack_ subnormal = less(x, Pack_::broadcast(std::numeric_limits<value_t>::min()));
+			const Pack_ scaled = select(subnormal, x * Pack_::broadcast(static_cast<value_t>(1ULL << (mantissa + 1))), x);
+
+			//	x = 2^e m, m in [1, 2) from the mantissa bits, e from the exponent
+			//	bits read back through the same magic as exp2_integral
+			Pack_ m = andnot(Pack_::broadcast(-std::numeric_limits<value_t>::infinity()), scaled) | one;
+			const auto base = static_cast<value_t>(1ULL << mantissa);
+			Pack_ e = (shift_right(scaled, mantissa_shift<value_t>) | Pack_::broadcast(base))
+				- Pack_::broadcast(base + static_cast<value_t>(exponent_bias<value_t>));
+
+			//	then m in [1 / sqrt2, sqrt2)
+			const Pack_ high = less(Pack_::broadcast(static_cast<value_t>(sqrt2)), m);
+			m = select(high, m * Pack_::broadcast(value_t(0.5)), m);
+			e = e + (high & one) - (subnormal & Pack_::broadcast(static_cast<value_t>(mantissa + 1)));
+
+			//	log m = 2 atanh(s), s = (m - 1) / (m + 1)
+			const Pack_ s = (m - one) / (m + one);
+			const Pack_ polynomial = approximate(meta::type_c<LogKernel>, meta::type_c<Accuracy_>, s * s);
+			const Pack_ twice = s + s;
+
+			Pack_ result = fma(e, Pack_::broadcast(ln2_split.rest), twice * polynomial);
+			result = fma(e, Pack_::broadcast(ln2_split.hi), result);
+
+			//	+inf and nan pass through, negatives are nan and zeros -inf
+			result = select(less(x, infinity), result, x);
+			result = select(less(x, zero), Pack_::broadcast(std::numeric_limits<value_t>::quiet_NaN()), result);
+			return select(equal(x, zero), -infinity, result);
+		}
+
+		//	sin(x + quadrant pi / 2) from libm one lane at a time for the finite
+		//	lanes at or past limit, result elsewhere. Kept out of line so that the
+		//	packed loop around sin does not pay for it
+		template <typename Pack_>
+		[[gnu::noinline, gnu::cold]]
+		inline Pack_ sin_libm(Pack_ x, Pack_ result, typename Pack_::value_t quadrant, typename Pack_::value_t limit)
+		{
+			using value_t = typename Pack_::value_t;
+
+			value_t inputs[Pack_::width], outputs[Pack_::width];
+			x.store(inputs);
+			result.store(outputs);
+
+			for (std::size_t lane = 0; lane < Pack_::width; ++lane)
+				if (std::fabs(inputs[lane]) >= limit && std::isfinite(inputs[lane]))
+					outputs[lane] = quadrant == 0 ? std::sin(inputs[lane]) : std::cos(inputs[lane]);
+			return Pack_::load(outputs);
+		}
+
+		//	sin(x + quadrant pi / 2), 0 for sin and 1 for cos. The reduction is
+		//	exact for |x| < 2^12 pi / 2, or for any |x| with a fused multiply
+		//	add; past 2^(mantissa_bits - 1) the quadrant is lost and those lanes
+		//	go through libm, a slow path that ordinary arguments never take
+		template <typename Accuracy_, typename Pack_>
+		inline constexpr Pack_ sin(Pack_ x, typename Pack_::value_t quadrant)
+		{
+			using value_t = typename Pack_::value_t;
+
+			constexpr std::size_t lane = sizeof(value_t) * 8;
+			constexpr Split<value_t> pi_2_split(pi_2, pi_2_residual);
+
+			//	x = n pi / 2 + r, |r| <= pi / 4
+			const Pack_ rounded = fma(x, Pack_::broadcast(static_cast<value_t>(1 / pi_2)), round_magic<Pack_>());
+			const Pack_ n = rounded - round_magic<Pack_>();
+			Pack_ r = fma(n, Pack_::broadcast(-pi_2_split.hi), x);
+			r = fma(n, Pack_::broadcast(-pi_2_split.mid), r);
+			r = fma(n, Pack_::broadcast(-pi_2_split.lo), r);
+
+			const Pack_ u = r * r;
+			const Pack_ sine = r * approximate(meta::type_c<SinKernel>, meta::type_c<Accuracy_>, u);
+			const Pack_ cosine = approximate(meta::type_c<CosKernel>, meta::type_c<Accuracy_>, u);
+
+			//	bit 0 of the quadrant picks cos r, bit 1 flips the sign
+			const Pack_ q = rounded + Pack_::broadcast(quadrant);
+			const Pack_ odd = less(shift_left(q, std::integral_constant<std::size_t, lane - 1>{}) | Pack_::broadcast(value_t(1)),
+				Pack_::zero());
+			const Pack_ sign = shift_left(q, std::integral_constant<std::size_t, lane - 2>{}) & sign_mask<Pack_>();
+			const Pack_ result = select(odd, cosine, sine) ^ sign;
+
+			constexpr auto limit = static_cast<value_t>(1ULL << (mantissa_bits<value_t> - 1));
+			const Pack_ magnitude = absolute(x);
+			const Pack_ checked = select(less(magnitude, Pack_::broadcast(limit)), result,
+				Pack_::broadcast(std::numeric_limits<value_t>::quiet_NaN()));
+
+			//	limit - 1/2 is the value just below limit, so a single comparison
+			//	finds |x| >= limit; infinities go to the slow path and stay nan
+			const bool large = any(less(Pack_::broadcast(limit - value_t(0.5)), magnitude));
+			return large ? sin_libm(x, checked, quadrant, limit) : checked;
+		}
+
+		template <typename Accuracy_, typename Pack_>
+		inline constexpr Pack_ erf(Pack_ x)
+		{
+			using value_t = typename Pack_::value_t;
+			using erfc_kernel_t = ErfcKernel<value_t, Accuracy_>;
+
+			const Pack_ one = Pack_::broadcast(value_t(1));
+			const Pack_ magnitude = absolute(x);
+
+			//	|x| < 1, erf x = x P(x^2)
+			const Pack_ inner = x * approximate(meta::type_c<ErfKernel>, meta::type_c<Accuracy_>, x * x);
+
+			//	|x| >= 1, erf x = 1 - e^-x^2 Q(x), x^2 split in two for an accurate e^-x^2
+			const Pack_ a = min(magnitude, Pack_::broadcast(static_cast<value_t>(erfc_kernel_t::upper)));
+			const Pack_ square = a * a;
+			const Pack_ square_tail = fma(a, a, -square);
+			Pack_ gaussian = exp<Accuracy_>(-square);
+			gaussian = fma(-square_tail, gaussian, gaussian);
+
+			const Pack_ erfc = gaussian * approximate(meta::type_c<erfc_kernel_t>, meta::type_c<Accuracy_>, a);
+			const Pack_ outer = (one - erfc) | (x & sign_mask<Pack_>());
+
+			return select(equal(x, x), select(less(magnitude, one), inner, outer), x);
+		}
+
+		template <typename Type_, typename Function_>
+		inline void transform(std::size_t size, const Type_ * input, Type_ * output, Function_ function)
+		{ map<native_pack_t<Type_>>(size, function, output, input); }
+	}
+
+	//*******************************************
+	//			packs
+	//*******************************************
+
+	template <typename Accuracy_ = accuracy::Full, typename Type_, typename Isa_>
+	inline constexpr Pack<Type_, Isa_> exp(Pack<Type_, Isa_> x) { return detail::exp<Accuracy_>(x); }
+
+	template <typename Accuracy_ = accuracy::Full, typename Type_, typename Isa_>
+	inline constexpr Pack<Type_, Isa_> log(Pack<Type_, Isa_> x) { return detail::log<Accuracy_>(x); }
+
+	template <typename Accuracy_ = accuracy::Full, typename Type_, typename Isa_>
+	inline constexpr Pack<Type_, Isa_> sin(Pack<Type_, Isa_> x) { return detail::sin<Accuracy_>(x, Type_(0)); }
+
+	template <typename Accuracy_ = accuracy::Full, typename Type_, typename Isa_>
+	inline constexpr Pack<Type_, Isa_> cos(Pack<Type_, Isa_> x) { return detail::sin<Accuracy_>(x, Type_(1)); }
+
+	template <typename Accuracy_ = accuracy::Full, typename Type_, typename Isa_>
+	inline constexpr Pack<Type_, Isa_> erf(Pack<Type_, Isa_> x) { return detail::erf<Accuracy_>(x); }
+
+	//*******************************************
+	//			arrays
+	//*******************************************
+
+	//	output[i] = f(input[i]) over native packs, in place is allowed
+
+#define		SIGMA_MATH_TRANSCENDENTAL_ARRAY(function_)																\
+	template <typename Accuracy_ = accuracy::Full, typename Type_>													\
+	inline void function_(std::size_t size, const Type_ * input, Type_ * output)									\
+	{																												\
+		static_assert(is_vectorisable(meta::type_c<Type_>), "transcendentals require float or double");			\
+		detail::transform(size, input, output, [](auto x) { return detail::function_<Accuracy_>(x); });			\
+	}
+
+	SIGMA_MATH_TRANSCENDENTAL_ARRAY(exp)
+	SIGMA_MATH_TRANSCENDENTAL_ARRAY(log)
+	SIGMA_MATH_TRANSCENDENTAL_ARRAY(erf)
+
+#undef		SIGMA_MATH_TRANSCENDENTAL_ARRAY
+
+	template <typename Accuracy_ = accuracy::Full, typename Type_>
+	inline void sin(std::size_t size, const Type_ * input, Type_ * output)
+	{
+		static_assert(is_vectorisable(meta::type_c<Type_>), "transcendentals require float or double");
+		detail::transform(size, input, output, [](auto x) { return detail::sin<Accuracy_>(x, Type_(0)); });
+	}
+
+	template <typename Accuracy_ = accuracy::Full, typename Type_>
+	inline void cos(std::size_t size, const Type_ * input, Type_ * output)
+	{
+		static_assert(is_vectorisable(meta::type_c<Type_>), "transcendentals require float or double");
+		detail::transform(size, input, output, [](auto x) { return detail::sin<Accuracy_>(x, Type_(1)); });
+	}
+
+	//*******************************************
+	//			expressions
+	//*******************************************
+
+	namespace op
+	{
+		template <typename Accuracy_>
+		struct Exp { template <typename Pack_> static Pack_ apply(Pack_ value) { return detail::exp<Accuracy_>(value); } };
+
+		template <typename Accuracy_>
+		struct Log { template <typename Pack_> static Pack_ apply(Pack_ value) { return detail::log<Accuracy_>(value); } };
+
+		template <typename Accuracy_>
+		struct Sin
+		{
+			template <typename Pack_>
+			static Pack_ apply(Pack_ value) { return detail::sin<Accuracy_>(value, typename Pack_::value_t(0)); }
+		};
+
+		template <typename Accuracy_>
+		struct Cos
+		{
+			template <typename Pack_>
+			static Pack_ apply(Pack_ value) { return detail::sin<Accuracy_>(value, typename Pack_::value_t(1)); }
+		};
+
+		template <typename Accuracy_>
+		struct Erf { template <typename Pack_> static Pack_ apply(Pack_ value) { return detail::erf<Accuracy_>(value); } };
+	}
+
+	//	fused into the surrounding expression, e.g. Array y = exp(-0.5 * x * x)
+
+	template <typename Accuracy_ = accuracy::Full, typename Operand_>
+	inline constexpr auto exp(const Expression<Operand_> & operand)
+	{ return detail::make_node<op::Exp<Accuracy_>>(detail::node(operand)); }
+
+	template <typename Accuracy_ = accuracy::Full, typename Operand_>
+	inline constexpr auto log(const Expression<Operand_> & operand)
+	{ return detail::make_node<op::Log<Accuracy_>>(detail::node(operand)); }
+
+	template <typename Accuracy_ = accuracy::Full, typename Operand_>
+	inline constexpr auto sin(const Expression<Operand_> & operand)
+	{ return detail::make_node<op::Sin<Accuracy_>>(detail::node(operand)); }
+
+	template <typename Accuracy_ = accuracy::Full, typename Operand_>
+	inline constexpr auto cos(const Expression<Operand_> & operand)
+	{ return detail::make_node<op::Cos<Accuracy_>>(detail::node(operand)); }
+
+	template <typename Accuracy_ = accuracy::Full, typename Operand_>
+	inline constexpr auto erf(const Expression<Operand_> & operand)
+	{ return detail::make_node<op::Erf<Accuracy_>>(detail::node(operand)); }
+}
+
+#endif	//	_SIGMA_API_MATH_ALGORITHM_TRANSCENDENTAL_HPP_
\ No newline at end of file
@@ -0,0 +1,337 @@
+#ifndef		_SIGMA_API_MATH_BENCHMARK_BENCHMARK_HPP_
+#define		_SIGMA_API_MATH_BENCHMARK_BENCHMARK_HPP_
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <sigma/meta/container/vector.hpp>
+#include "counters.hpp"
+
+namespace sigma::math::benchmark
+{
+	//	Benchmarks are registered by the macros at the bottom of this file and
+	//	run by run(options). Each one is warmed up while its iteration count is
+	//	calibrated, then timed over a number of repetitions; the report keeps
+	//	the median and the median absolute deviation per iteration, which unlike
+	//	the mean and the standard deviation ignore the odd preempted repetition
+
+	//*******************************************
+	//			optimisation barriers
+	//*******************************************
+
+	//	value is treated as read and, unless const, possibly written by
+	//	opaque code, so neither it nor the work producing it is removed
+
+	template <typename Type_>
+	inline void do_not_optimize(const Type_ & value) { asm volatile("" : : "r,m"(value) : "memory"); }
+
+	template <typename Type_>
+	inline void do_not_optimize(Type_ & value)
+	{
+		if constexpr (std::is_trivially_copyable_v<Type_> && sizeof(Type_) <= sizeof(void *))
+			asm volatile("" : "+r,m"(value) : : "memory");
+		else
+			asm volatile("" : "+m"(value) : : "memory");
+	}
+
+	//	pending stores are treated as observed
+	inline void clobber_memory(void) { asm volatile("" : : : "memory"); }
+
+	//*******************************************
+	//			state
+	//*******************************************
+
+	//	handed to the benchmark body, whose measured region is the range for
+	//		for (auto _ : state) { ... }
+	//	the clock and the counters start in begin() and stop when the loop
+	//	reaches end(), so setup before the loop and teardown after it are free
+
+	class State
+	{
+		using clock_t = std::chrono::steady_clock;
+
+		std::size_t iterations_;
+		std::size_t items_ = 0;
+		std::size_t bytes_ = 0;
+		Counters * counters_;
+		clock_t::time_point start_{};
+		double seconds_ = 0;
+		Sample sample_{};
+		bool running_ = false;
+		bool measured_ = false;
+
+		void start(void)
+		{
+			if (counters_) counters_->start();
+			running_ = true;
+			start_ = clock_t::now();
+		}
+
+	public:
+
+		class Iterator
+		{
+			std::size_t remaining_;
+			State * state_;
+
+		public:
+
+			//	variables of the type may go unused, so the loop variable
+			//	above raises no warning
+			struct [[gnu::unused]] Value {};
+
+			Iterator(std::size_t remaining, State * state) : remaining_(remaining), state_(state) {}
+
+			Value operator * (void) const { return {}; }
+			Iterator & operator ++ (void) { --remaining_; return *this; }
+
+			bool operator != (const Iterator &) const
+			{
+				if (remaining_ != 0) return true;
+				if (state_) state_->stop();
+				return false;
+			}
+		};
+
+		//	counters, when given, are read over the measured region
+		explicit State(std::size_t iterations, Counters * counters = nullptr)
+			: iterations_(iterations), counters_(counters) {}
+
+		Iterator begin(void) { start(); return Iterator(iterations_, this); }
+		Iterator end(void) { return Iterator(0, nullptr); }
+
+		//	ends the measured region, later calls keep the first figures
+		void stop(void)
+		{
+			if (!running_) return;
+
+			const std::chrono::duration<double> elapsed = clock_t::now() - start_;
+			if (counters_) sample_ = counters_->stop();
+			seconds_ = elapsed.count();
+			running_ = false;
+			measured_ = true;
+		}
+
+		//	false until the loop has run to its end, or stop() was called
+		bool measured(void) const { return measured_; }
+		double seconds(void) const { return seconds_; }
+		const Sample & sample(void) const { return sample_; }
+
+		std::size_t iterations(void) const { return iterations_; }
+
+		//	work done by one iteration, reported as rates
+		void set_items(std::size_t items) { items_ = items; }
+		void set_bytes(std::size_t bytes) { bytes_ = bytes; }
+
+		std::size_t items(void) const { return items_; }
+		std::size_t bytes(void) const { return bytes_; }
+	};
+
+	//*******************************************
+	//			registry
+	//*******************************************
+
+	using Function = void (*)(State &);
+
+	struct Benchmark
+	{
+		std::string name;
+		Function function;
+	};
+
+	inline std::vector<Benchmark> & registry(void)
+	{
+		static std::vector<Benchmark> benchmarks;
+		return benchmarks;
+	}
+
+	inline bool add(std::string name, Function function)
+	{
+		registry().push_back({ std::move(name), function });
+		return true;
+	}
+
+	//	one benchmark per value of the sweep, named name/value; factory maps an
+	//	integral_constant of the value to the instantiation for it
+
+	template <auto... values_, typename Factory_>
+	inline bool add(const std::string & name, meta::VVector<values_...>, Factory_ factory)
+	{
+		return (add(name + "/" + std::to_string(values_),
+			factory(std::integral_constant<decltype(values_), values_>{})) && ...);
+	}
+
+	//*******************************************
+	//			statistics
+	//*******************************************
+
+	inline double median(std::vector<double> values)
+	{
+		if (values.empty()) return 0;
+
+		const std::size_t middle = values.size() / 2;
+		std::nth_element(values.begin(), values.begin() + middle, values.end());
+		if (values.size() % 2) return values[middle];
+
+		const double upper = values[middle];
+		return (*std::max_element(values.begin(), values.begin() + middle) + upper) / 2;
+	}
+
+	//	median of the distances to the median
+	inline double median_absolute_deviation(const std::vector<double> & values)
+	{
+		const double centre = median(values);
+		std::vector<double> deviations;
+		for (double value : values) deviations.push_back(std::fabs(value - centre));
+		return median(deviations);
+	}
+
+	//*******************************************
+	//			running
+	//*******************************************
+
+	struct Options
+	{
+		std::string filter;					//	substring of the names to run, all when empty
+		std::size_t repetitions = 15;
+		double warmup_seconds = 0.05;
+		double repetition_seconds = 0.01;	//	least duration of one repetition
+		std::size_t max_iterations = 1000000000;	//	per repetition, for bodies too fast to time
+	};
+
+	//	per iteration figures over the repetitions
+	struct Result
+	{
+		std::string name;
+		std::size_t iterations;				//	per repetition
+		std::size_t repetitions;
+		double median_ns;
+		double deviation_ns;				//	median absolute deviation
+		double minimum_ns;
+		std::size_t items;
+		std::size_t bytes;
+		Sample counters;					//	medians, absent when unavailable
+	};
+
+	namespace detail
+	{
+		//	the measured region of the body, up to its return when it left the
+		//	loop early, or the whole call when it never started the loop
+		inline double seconds(Function function, State & state)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			function(state);
+			const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+			state.stop();
+			return state.measured() ? state.seconds() : elapsed.count();
+		}
+
+		//	scales the iteration count by the shortfall of the last run, between
+		//	2x and 100x a step, until one run lasts the repetition time, running
+		//	for at least the warmup time overall; the count stops growing at
+		//	options.max_iterations, which is returned as soon as it is reached
+		inline std::size_t calibrate(Function function, const Options & options)
+		{
+			const std::size_t limit = std::max<std::size_t>(options.max_iterations, 1);
+			std::size_t iterations = 1;
+			double warmed = 0;
+
+			for (;;)
+			{
+				State state(iterations);
+				const double elapsed = seconds(function, state);
+				warmed += elapsed;
+
+				if (elapsed >= options.repetition_seconds && warmed >= options.warmup_seconds) return iterations;
+				if (iterations >= limit) return limit;
+				if (elapsed < options.repetition_seconds)
+				{
+					const double scale = elapsed > 0 ? options.repetition_seconds / elapsed : 2;
+					const double grown = iterations * std::clamp(scale * 1.2, 2.0, 100.0);
+					iterations = grown >= static_cast<double>(limit) ? limit : static_cast<std::size_t>(grown);
+				}
+			}
+		}
+	}
+
+	inline Result run(const Benchmark & benchmark, const Options & options, Counters & counters)
+	{
+		const std::size_t iterations = detail::calibrate(benchmark.function, options);
+
+		std::vector<double> times;
+		std::array<std::vector<double>, counter_count> counts;
+		State state(iterations);
+
+		for (std::size_t repetition = 0; repetition < std::max<std::size_t>(options.repetitions, 1); ++repetition)
+		{
+			state = State(iterations, &counters);
+
+			const double elapsed = detail::seconds(benchmark.function, state);
+			const Sample & sample = state.sample();
+
+			times.push_back(elapsed * 1e9 / iterations);
+			for (std::size_t counter = 0; counter < counter_count; ++counter)
+				if (sample[counter]) counts[counter].push_back(*sample[counter] / iterations);
+		}
+
+		Result result{ benchmark.name, iterations, times.size(), median(times), median_absolute_deviation(times),
+			*std::min_element(times.begin(), times.end()), state.items(), state.bytes(), {} };
+
+		for (std::size_t counter = 0; counter < counter_count; ++counter)
+			if (counts[counter].size() == times.size()) result.counters[counter] = median(counts[counter]);
+
+		return result;
+	}
+
+	inline std::vector<Result> run(const Options & options)
+	{
+		Counters counters;
+		std::vector<Result> results;
+
+		for (const Benchmark & benchmark : registry())
+			if (benchmark.name.find(options.filter) != std::string::npos)
+				results.push_back(run(benchmark, options, counters));
+
+		return results;
+	}
+}
+
+//*******************************************
+//			registration
+//*******************************************
+
+//	SIGMA_BENCHMARK(name)
+//	{
+//		for (auto _ : state) ...
+//	}
+//
+//	SIGMA_BENCHMARK_SWEEP(name, sigma::meta::VVector<64, 256, 1024>)
+//	{
+//		std::vector<float> data(parameter_);		//	parameter_ is a constant
+//		for (auto _ : state) ...
+//	}
+
+#define		SIGMA_BENCHMARK(name_)																					\
+	static void sigma_benchmark_##name_(::sigma::math::benchmark::State & state);									\
+	static const bool sigma_benchmark_registered_##name_ =														\
+		::sigma::math::benchmark::add(#name_, &sigma_benchmark_##name_);											\
+	static void sigma_benchmark_##name_([[maybe_unused]] ::sigma::math::benchmark::State & state)
+
+#define		SIGMA_BENCHMARK_SWEEP(name_, ...)																		\
+	template <auto parameter_>																						\
+	static void sigma_benchmark_##name_(::sigma::math::benchmark::State & state);									\
+	static const bool sigma_benchmark_registered_##name_ =														\
+		::sigma::math::benchmark::add(#name_, __VA_ARGS__{}, [](auto parameter)										\
+		{ return &sigma_benchmark_##name_<decltype(parameter)::value>; });											\
+	template <auto parameter_>																						\
+	static void sigma_benchmark_##name_([[maybe_unused]] ::sigma::math::benchmark::State & state)
+
+#endif	//	_SIGMA_API_MATH_BENCHMARK_BENCHMARK_HPP_
\ No newline at end of file
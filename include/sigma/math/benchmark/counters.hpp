@@ -0,0 +1,178 @@
+#ifndef		_SIGMA_API_MATH_BENCHMARK_COUNTERS_HPP_
+#define		_SIGMA_API_MATH_BENCHMARK_COUNTERS_HPP_
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string_view>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace sigma::math::benchmark
+{
+	//	Hardware and software counters of the calling thread, user space only so
+	//	that perf_event_paranoid up to 2 allows them. Events the kernel, the
+	//	hypervisor or the seccomp profile refuse are simply absent from the
+	//	samples, as are events the kernel never scheduled; events it multiplexed
+	//	are scaled by the share of the time they were counting. The time stamp
+	//	counter is read directly where the CPU has one
+
+	struct Event
+	{
+		const char * name;
+		std::uint32_t type;
+		std::uint64_t config;
+	};
+
+#if defined(__linux__)
+	inline constexpr std::array<Event, 5> events = { {
+		{ "cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+		{ "instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+		{ "cache_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+		{ "branch_misses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+		{ "page_faults", PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS } } };
+#else
+	inline constexpr std::array<Event, 0> events = {};
+#endif
+
+	//	the time stamp counter follows the events in a sample
+	inline constexpr std::size_t counter_count = events.size() + 1;
+
+	inline constexpr const char * counter_name(std::size_t counter)
+	{ return counter < events.size() ? events[counter].name : "reference_cycles"; }
+
+	//	counter_count when there is no such counter
+	inline constexpr std::size_t counter_index(std::string_view name)
+	{
+		for (std::size_t counter = 0; counter < counter_count; ++counter)
+			if (name == counter_name(counter)) return counter;
+		return counter_count;
+	}
+
+	using Sample = std::array<std::optional<double>, counter_count>;
+
+	class Counters
+	{
+		std::array<int, events.size()> descriptors_;
+		int leader_ = -1;
+		std::uint64_t timestamp_ = 0;
+
+#if defined(__linux__)
+		static int open(const Event & event, int group)
+		{
+			perf_event_attr attributes;
+			std::memset(&attributes, 0, sizeof(attributes));
+			attributes.size = sizeof(attributes);
+			attributes.type = event.type;
+			attributes.config = event.config;
+			attributes.disabled = group == -1;
+			attributes.exclude_kernel = 1;
+			attributes.exclude_hv = 1;
+			attributes.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+			return static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, group, 0));
+		}
+#endif
+
+		static std::uint64_t timestamp(void)
+		{
+#if defined(__x86_64__) || defined(__i386__)
+			return __rdtsc();
+#else
+			return 0;
+#endif
+		}
+
+	public:
+
+		//	the first event that opens leads the group, the others follow it
+		//	so that they are always scheduled together
+
+		Counters(void)
+		{
+			descriptors_.fill(-1);
+#if defined(__linux__)
+			for (std::size_t event = 0; event < events.size(); ++event)
+			{
+				descriptors_[event] = open(events[event], leader_);
+				if (leader_ == -1) leader_ = descriptors_[event];
+			}
+#endif
+		}
+
+		Counters(const Counters &) = delete;
+		Counters & operator = (const Counters &) = delete;
+
+		~Counters(void)
+		{
+#if defined(__linux__)
+			for (int descriptor : descriptors_)
+				if (descriptor != -1) close(descriptor);
+#endif
+		}
+
+		bool available(std::size_t counter) const
+		{
+			if (counter < events.size()) return descriptors_[counter] != -1;
+#if defined(__x86_64__) || defined(__i386__)
+			return true;
+#else
+			return false;
+#endif
+		}
+
+		void start(void)
+		{
+#if defined(__linux__)
+			if (leader_ != -1)
+			{
+				ioctl(leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+				ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+			}
+#endif
+			timestamp_ = timestamp();
+		}
+
+		Sample stop(void)
+		{
+			const std::uint64_t elapsed = timestamp() - timestamp_;
+			Sample sample{};
+
+#if defined(__linux__)
+			if (leader_ != -1)
+			{
+				ioctl(leader_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+				//	{ count, time enabled, time running, values in opening order },
+				//	the group is scheduled as a whole so the times are shared
+				std::array<std::uint64_t, events.size() + 3> values{};
+				if (read(leader_, values.data(), sizeof(values)) > 0 && values[2] != 0)
+				{
+					const double scale = static_cast<double>(values[1]) / static_cast<double>(values[2]);
+
+					std::size_t slot = 3;
+					for (std::size_t event = 0; event < events.size(); ++event)
+						if (descriptors_[event] != -1 && slot < values[0] + 3)
+							sample[event] = static_cast<double>(values[slot++]) * scale;
+				}
+			}
+#endif
+
+			if (available(events.size())) sample[events.size()] = static_cast<double>(elapsed);
+			return sample;
+		}
+	};
+}
+
+#endif	//	_SIGMA_API_MATH_BENCHMARK_COUNTERS_HPP_
\ No newline at end of file
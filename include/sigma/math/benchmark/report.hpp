@@ -0,0 +1,137 @@
+#ifndef		_SIGMA_API_MATH_BENCHMARK_REPORT_HPP_
+#define		_SIGMA_API_MATH_BENCHMARK_REPORT_HPP_
+
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+#include "../simd/pack.hpp"
+
+namespace sigma::math::benchmark
+{
+	namespace detail
+	{
+		inline constexpr const char * isa_name(meta::Type<isa::Scalar>) { return "scalar"; }
+		inline constexpr const char * isa_name(meta::Type<isa::SSE>) { return "sse2"; }
+		inline constexpr const char * isa_name(meta::Type<isa::AVX2>) { return "avx2"; }
+		inline constexpr const char * isa_name(meta::Type<isa::AVX512>) { return "avx512"; }
+
+		inline std::string escape(const std::string & text)
+		{
+			std::string result;
+			for (char character : text)
+			{
+				if (character == '"' || character == '\\') result += '\\';
+				if (static_cast<unsigned char>(character) < 0x20)
+				{
+					char code[8];
+					std::snprintf(code, sizeof(code), "\\u%04x", character);
+					result += code;
+				}
+				else result += character;
+			}
+			return result;
+		}
+
+		inline std::string number(double value)
+		{
+			char text[32];
+			std::snprintf(text, sizeof(text), "%.6g", value);
+			return text;
+		}
+
+		inline std::string timestamp(void)
+		{
+			const std::time_t now = std::time(nullptr);
+			char text[32];
+			std::strftime(text, sizeof(text), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+			return text;
+		}
+
+		inline double rate(std::size_t amount, double nanoseconds)
+		{ return nanoseconds > 0 ? amount * 1e9 / nanoseconds : 0; }
+	}
+
+	//	one line per result, counters per iteration where available
+
+	inline void print(std::ostream & stream, const std::vector<Result> & results)
+	{
+		char line[256];
+		std::snprintf(line, sizeof(line), "%-40s %12s %10s %12s %12s %10s\n",
+			"benchmark", "median ns", "mad ns", "items/s", "cycles", "ipc");
+		stream << line;
+
+		constexpr std::size_t cycles_index = counter_index("cycles");
+		constexpr std::size_t instructions_index = counter_index("instructions");
+
+		for (const Result & result : results)
+		{
+			const std::optional<double> none;
+			const auto & cycles = cycles_index < counter_count ? result.counters[cycles_index] : none;
+			const auto & instructions = instructions_index < counter_count ? result.counters[instructions_index] : none;
+
+			std::snprintf(line, sizeof(line), "%-40s %12.2f %10.2f %12.4g %12s %10s\n", result.name.c_str(),
+				result.median_ns, result.deviation_ns, detail::rate(result.items, result.median_ns),
+				cycles ? detail::number(*cycles).c_str() : "-",
+				cycles && instructions && *cycles > 0 ? detail::number(*instructions / *cycles).c_str() : "-");
+			stream << line;
+		}
+	}
+
+	//	{ "context": {...}, "benchmarks": [{...}] }, unavailable counters are null
+	//	so that builds on hosts with and without counters stay comparable
+
+	inline void write_json(std::ostream & stream, const std::vector<Result> & results)
+	{
+		stream << "{\n\t\"context\": {\n"
+			<< "\t\t\"date\": \"" << detail::timestamp() << "\",\n"
+			<< "\t\t\"compiler\": \"" << detail::escape(__VERSION__) << "\",\n"
+			<< "\t\t\"cplusplus\": " << __cplusplus << ",\n"
+#if defined(__OPTIMIZE__)
+			<< "\t\t\"optimized\": true,\n"
+#else
+			<< "\t\t\"optimized\": false,\n"
+#endif
+			<< "\t\t\"isa\": \"" << detail::isa_name(select_isa(meta::type_c<float>)) << "\"\n"
+			<< "\t},\n\t\"benchmarks\": [";
+
+		for (std::size_t index = 0; index < results.size(); ++index)
+		{
+			const Result & result = results[index];
+
+			stream << (index ? ",\n" : "\n") << "\t\t{\n"
+				<< "\t\t\t\"name\": \"" << detail::escape(result.name) << "\",\n"
+				<< "\t\t\t\"iterations\": " << result.iterations << ",\n"
+				<< "\t\t\t\"repetitions\": " << result.repetitions << ",\n"
+				<< "\t\t\t\"median_ns\": " << detail::number(result.median_ns) << ",\n"
+				<< "\t\t\t\"mad_ns\": " << detail::number(result.deviation_ns) << ",\n"
+				<< "\t\t\t\"min_ns\": " << detail::number(result.minimum_ns) << ",\n"
+				<< "\t\t\t\"items_per_second\": " << detail::number(detail::rate(result.items, result.median_ns)) << ",\n"
+				<< "\t\t\t\"bytes_per_second\": " << detail::number(detail::rate(result.bytes, result.median_ns));
+
+			for (std::size_t counter = 0; counter < counter_count; ++counter)
+				stream << ",\n\t\t\t\"" << counter_name(counter) << "\": "
+					<< (result.counters[counter] ? detail::number(*result.counters[counter]) : "null");
+
+			stream << "\n\t\t}";
+		}
+
+		stream << "\n\t]\n}\n";
+	}
+
+	inline bool write_json(const std::string & path, const std::vector<Result> & results)
+	{
+		std::ofstream file(path);
+		if (!file) return false;
+
+		write_json(file, results);
+		return static_cast<bool>(file);
+	}
+}
+
+#endif	//	_SIGMA_API_MATH_BENCHMARK_REPORT_HPP_
\ No newline at end of file
@@ -0,0 +1,90 @@
+#ifndef		_SIGMA_API_MATH_CONTAINER_ARRAY_HPP_
+#define		_SIGMA_API_MATH_CONTAINER_ARRAY_HPP_
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+#include <vector>
+#include "expression.hpp"
+
+namespace sigma::math
+{
+	//	Runtime sized array taking part in lazy expressions, assigning an
+	//	expression evaluates the whole tree in one fused loop with no temporaries
+
+	template <typename Type_>
+	class Array : public Expression<Array<Type_>>
+	{
+		static_assert(meta::is_arithmetic(meta::type_c<Type_>), "array requires arithmetic elements");
+
+		std::vector<Type_> data_;
+
+	public:
+
+		using value_t = Type_;
+
+		Array(void) = default;
+		explicit Array(std::size_t size, Type_ value = Type_{}) : data_(size, value) {}
+		Array(std::initializer_list<Type_> values) : data_(values) {}
+
+		template <typename Derived_>
+		Array(const Expression<Derived_> & expression)
+		{
+			const auto root = detail::node(expression);
+			if (root.size() == any_size) throw std::invalid_argument("expression has no array operand");
+			data_.resize(root.size());
+			detail::evaluate(root, data_.data(), data_.size());
+		}
+
+		//	element-wise reads of the array inside the expression happen
+		//	before the write of the same element, so aliasing is safe
+
+		template <typename Derived_>
+		Array & operator = (const Expression<Derived_> & expression)
+		{
+			const auto root = detail::node(expression);
+			if (root.size() != any_size && root.size() != data_.size()) data_.resize(root.size());
+			detail::evaluate(root, data_.data(), data_.size());
+			return *this;
+		}
+
+		template <typename Derived_>
+		Array & operator += (const Expression<Derived_> & expression) { return *this = *this + expression; }
+
+		template <typename Derived_>
+		Array & operator -= (const Expression<Derived_> & expression) { return *this = *this - expression; }
+
+		template <typename Derived_>
+		Array & operator *= (const Expression<Derived_> & expression) { return *this = *this * expression; }
+
+		template <typename Derived_>
+		Array & operator /= (const Expression<Derived_> & expression) { return *this = *this / expression; }
+
+		Array & operator += (Type_ value) { return *this = *this + value; }
+		Array & operator -= (Type_ value) { return *this = *this - value; }
+		Array & operator *= (Type_ value) { return *this = *this * value; }
+		Array & operator /= (Type_ value) { return *this = *this / value; }
+
+		Terminal<Type_> node(void) const { return Terminal<Type_>(data_.data(), data_.size()); }
+
+		std::size_t size(void) const { return data_.size(); }
+		bool empty(void) const { return data_.empty(); }
+		void resize(std::size_t size, Type_ value = Type_{}) { data_.resize(size, value); }
+
+		Type_ & operator[] (std::size_t index) { return data_[index]; }
+		const Type_ & operator[] (std::size_t index) const { return data_[index]; }
+
+		Type_ * data(void) { return data_.data(); }
+		const Type_ * data(void) const { return data_.data(); }
+
+		Type_ * begin(void) { return data_.data(); }
+		Type_ * end(void) { return data_.data() + data_.size(); }
+		const Type_ * begin(void) const { return data_.data(); }
+		const Type_ * end(void) const { return data_.data() + data_.size(); }
+
+		friend bool operator == (const Array & lhs, const Array & rhs) { return lhs.data_ == rhs.data_; }
+		friend bool operator != (const Array & lhs, const Array & rhs) { return !(lhs == rhs); }
+	};
+}
+
+#endif	//	_SIGMA_API_MATH_CONTAINER_ARRAY_HPP_
\ No newline at end of file
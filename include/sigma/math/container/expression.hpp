@@ -0,0 +1,330 @@
+#ifndef		_SIGMA_API_MATH_CONTAINER_EXPRESSION_HPP_
+#define		_SIGMA_API_MATH_CONTAINER_EXPRESSION_HPP_
+
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "../simd/pack.hpp"
+
+namespace sigma::math
+{
+	//	Lazy element-wise expressions over runtime arrays. Operators build a
+	//	tree of nodes held by value, nothing is computed until the tree is
+	//	assigned to an Array, which evaluates it in a single packed loop.
+	//	Every node provides
+	//		value_t					element type
+	//		size()					element count, any_size for broadcast constants
+	//		node()					the node stored in a parent, a copy or a terminal
+	//		load<Pack_>(index)		the pack starting at index
+
+	inline constexpr std::size_t any_size = static_cast<std::size_t>(-1);
+
+	template <typename Derived_>
+	struct Expression
+	{
+		constexpr const Derived_ & derived(void) const { return static_cast<const Derived_ &>(*this); }
+	};
+
+	//		**	OPERATIONS **
+
+	namespace op
+	{
+		struct Add { template <typename Pack_> static Pack_ apply(Pack_ lhs, Pack_ rhs) { return lhs + rhs; } };
+		struct Sub { template <typename Pack_> static Pack_ apply(Pack_ lhs, Pack_ rhs) { return lhs - rhs; } };
+		struct Mul { template <typename Pack_> static Pack_ apply(Pack_ lhs, Pack_ rhs) { return lhs * rhs; } };
+		struct Div { template <typename Pack_> static Pack_ apply(Pack_ lhs, Pack_ rhs) { return lhs / rhs; } };
+		struct Neg { template <typename Pack_> static Pack_ apply(Pack_ value) { return -value; } };
+		struct Min { template <typename Pack_> static Pack_ apply(Pack_ lhs, Pack_ rhs) { return min(lhs, rhs); } };
+		struct Max { template <typename Pack_> static Pack_ apply(Pack_ lhs, Pack_ rhs) { return max(lhs, rhs); } };
+
+		//	lhs * rhs + addend, introduced by simplification
+		struct Fma
+		{
+			template <typename Pack_>
+			static Pack_ apply(Pack_ lhs, Pack_ rhs, Pack_ addend) { return fma(lhs, rhs, addend); }
+		};
+	}
+
+	//		**	NODES **
+
+	template <typename Type_>
+	class Terminal : public Expression<Terminal<Type_>>
+	{
+		const Type_ * data_;
+		std::size_t size_;
+
+	public:
+
+		using value_t = Type_;
+
+		constexpr Terminal(const Type_ * data, std::size_t size) : data_(data), size_(size) {}
+
+		constexpr Terminal node(void) const { return *this; }
+		constexpr std::size_t size(void) const { return size_; }
+
+		template <typename Pack_>
+		Pack_ load(std::size_t index) const { return Pack_::load(data_ + index); }
+	};
+
+	template <typename Type_>
+	class Constant : public Expression<Constant<Type_>>
+	{
+		Type_ value_;
+
+	public:
+
+		using value_t = Type_;
+
+		constexpr explicit Constant(Type_ value) : value_(value) {}
+
+		constexpr Constant node(void) const { return *this; }
+		constexpr std::size_t size(void) const { return any_size; }
+		constexpr Type_ value(void) const { return value_; }
+
+		template <typename Pack_>
+		Pack_ load(std::size_t) const { return Pack_::broadcast(value_); }
+	};
+
+	template <typename Op_, typename... Operands_>
+	class Node : public Expression<Node<Op_, Operands_...>>
+	{
+		using first_t = typename decltype(meta::TVector<Operands_...>::front())::type_t;
+
+		//	every operand must share the element type of the first
+		static_assert(meta::filter(meta::TVector<typename Operands_::value_t...>{}, [](auto type)
+			{ return meta::is_same(type, meta::type_c<typename first_t::value_t>); }).size() == 0,
+			"expression operands require a common element type");
+
+		std::tuple<Operands_...> operands_;
+		std::size_t size_;
+
+		static constexpr std::size_t combine(std::size_t lhs, std::size_t rhs)
+		{
+			if (lhs != any_size && rhs != any_size && lhs != rhs)
+				throw std::invalid_argument("expression operands differ in size");
+			return lhs == any_size ? rhs : lhs;
+		}
+
+		template <std::size_t... indices_>
+		constexpr std::size_t combine_all(std::index_sequence<indices_...>) const
+		{
+			std::size_t result = any_size;
+			((result = combine(result, std::get<indices_>(operands_).size())), ...);
+			return result;
+		}
+
+		template <typename Pack_, std::size_t... indices_>
+		Pack_ load(std::size_t index, std::index_sequence<indices_...>) const
+		{ return Op_::apply(std::get<indices_>(operands_).template load<Pack_>(index)...); }
+
+	public:
+
+		using value_t = typename first_t::value_t;
+		using op_t = Op_;
+
+		constexpr Node(Operands_... operands)
+			: operands_(std::move(operands)...), size_(combine_all(std::index_sequence_for<Operands_...>{}))
+		{}
+
+		constexpr Node node(void) const { return *this; }
+		constexpr std::size_t size(void) const { return size_; }
+
+		template <std::size_t index_>
+		constexpr const auto & operand(std::integral_constant<std::size_t, index_>) const
+		{ return std::get<index_>(operands_); }
+
+		template <typename Pack_>
+		Pack_ load(std::size_t index) const { return load<Pack_>(index, std::index_sequence_for<Operands_...>{}); }
+	};
+
+	//		**	SIMPLIFICATION **
+
+	template <typename Type_>
+	inline constexpr bool is_product(meta::Type<Type_>) { return false; }
+
+	template <typename LHS_, typename RHS_>
+	inline constexpr bool is_product(meta::Type<Node<op::Mul, LHS_, RHS_>>) { return true; }
+
+	template <typename Type_>
+	inline constexpr bool is_negation(meta::Type<Type_>) { return false; }
+
+	template <typename Operand_>
+	inline constexpr bool is_negation(meta::Type<Node<op::Neg, Operand_>>) { return true; }
+
+	template <typename Type_>
+	inline constexpr bool is_constant(meta::Type<Type_>) { return false; }
+
+	template <typename Type_>
+	inline constexpr bool is_constant(meta::Type<Constant<Type_>>) { return true; }
+
+	namespace detail
+	{
+		//	Arrays enter the tree as terminals, nodes are copied in
+
+		template <typename Derived_>
+		inline constexpr auto node(const Expression<Derived_> & expression)
+		{ return expression.derived().node(); }
+
+		template <typename Op_, typename... Operands_>
+		inline constexpr auto make_node(Operands_... operands)
+		{ return Node<Op_, Operands_...>(std::move(operands)...); }
+
+		template <typename Operand_>
+		inline constexpr auto negate(Operand_ operand)
+		{
+			//	-(-x) -> x, -c -> (-c)
+			if constexpr (is_negation(meta::type_c<Operand_>)) return operand.operand(std::integral_constant<std::size_t, 0>{});
+			else if constexpr (is_constant(meta::type_c<Operand_>)) return Constant(-operand.value());
+			else return make_node<op::Neg>(std::move(operand));
+		}
+
+		template <typename LHS_, typename RHS_>
+		inline constexpr auto add(LHS_ lhs, RHS_ rhs)
+		{
+			constexpr std::integral_constant<std::size_t, 0> first{};
+			constexpr std::integral_constant<std::size_t, 1> second{};
+
+			//	a * b + c -> fma(a, b, c), c + a * b -> fma(a, b, c)
+			if constexpr (is_product(meta::type_c<LHS_>))
+				return make_node<op::Fma>(lhs.operand(first), lhs.operand(second), std::move(rhs));
+			else if constexpr (is_product(meta::type_c<RHS_>))
+				return make_node<op::Fma>(rhs.operand(first), rhs.operand(second), std::move(lhs));
+			else if constexpr (is_constant(meta::type_c<LHS_>) && is_constant(meta::type_c<RHS_>))
+				return Constant(lhs.value() + rhs.value());
+			else
+				return make_node<op::Add>(std::move(lhs), std::move(rhs));
+		}
+
+		template <typename LHS_, typename RHS_>
+		inline constexpr auto subtract(LHS_ lhs, RHS_ rhs)
+		{
+			constexpr std::integral_constant<std::size_t, 0> first{};
+			constexpr std::integral_constant<std::size_t, 1> second{};
+
+			//	a * b - c -> fma(a, b, -c), c - a * b -> fma(-a, b, c)
+			if constexpr (is_product(meta::type_c<LHS_>))
+				return make_node<op::Fma>(lhs.operand(first), lhs.operand(second), negate(std::move(rhs)));
+			else if constexpr (is_product(meta::type_c<RHS_>))
+				return make_node<op::Fma>(negate(rhs.operand(first)), rhs.operand(second), std::move(lhs));
+			else if constexpr (is_constant(meta::type_c<LHS_>) && is_constant(meta::type_c<RHS_>))
+				return Constant(lhs.value() - rhs.value());
+			else
+				return make_node<op::Sub>(std::move(lhs), std::move(rhs));
+		}
+
+		template <typename Value_, typename Expression_>
+		using enable_constant_t = std::enable_if_t<std::is_arithmetic_v<Value_>, Constant<typename Expression_::value_t>>;
+	}
+
+	//		**	OPERATORS **
+
+	template <typename LHS_, typename RHS_>
+	inline constexpr auto operator + (const Expression<LHS_> & lhs, const Expression<RHS_> & rhs)
+	{ return detail::add(detail::node(lhs), detail::node(rhs)); }
+
+	template <typename LHS_, typename RHS_>
+	inline constexpr auto operator - (const Expression<LHS_> & lhs, const Expression<RHS_> & rhs)
+	{ return detail::subtract(detail::node(lhs), detail::node(rhs)); }
+
+	template <typename LHS_, typename RHS_>
+	inline constexpr auto operator * (const Expression<LHS_> & lhs, const Expression<RHS_> & rhs)
+	{ return detail::make_node<op::Mul>(detail::node(lhs), detail::node(rhs)); }
+
+	template <typename LHS_, typename RHS_>
+	inline constexpr auto operator / (const Expression<LHS_> & lhs, const Expression<RHS_> & rhs)
+	{ return detail::make_node<op::Div>(detail::node(lhs), detail::node(rhs)); }
+
+	template <typename Operand_>
+	inline constexpr auto operator - (const Expression<Operand_> & operand)
+	{ return detail::negate(detail::node(operand)); }
+
+	template <typename LHS_, typename RHS_>
+	inline constexpr auto min(const Expression<LHS_> & lhs, const Expression<RHS_> & rhs)
+	{ return detail::make_node<op::Min>(detail::node(lhs), detail::node(rhs)); }
+
+	template <typename LHS_, typename RHS_>
+	inline constexpr auto max(const Expression<LHS_> & lhs, const Expression<RHS_> & rhs)
+	{ return detail::make_node<op::Max>(detail::node(lhs), detail::node(rhs)); }
+
+	//	arithmetic values on either side are broadcast as constants
+
+#define		SIGMA_MATH_EXPRESSION_SCALAR_OPERATOR(operator_)														\
+	template <typename LHS_, typename Value_, typename = detail::enable_constant_t<Value_, LHS_>>						\
+	inline constexpr auto operator_ (const Expression<LHS_> & lhs, Value_ rhs)										\
+	{ return operator_(lhs, Constant<typename LHS_::value_t>(static_cast<typename LHS_::value_t>(rhs))); }			\
+																													\
+	template <typename Value_, typename RHS_, typename = detail::enable_constant_t<Value_, RHS_>>						\
+	inline constexpr auto operator_ (Value_ lhs, const Expression<RHS_> & rhs)										\
+	{ return operator_(Constant<typename RHS_::value_t>(static_cast<typename RHS_::value_t>(lhs)), rhs); }
+
+	SIGMA_MATH_EXPRESSION_SCALAR_OPERATOR(operator +)
+	SIGMA_MATH_EXPRESSION_SCALAR_OPERATOR(operator -)
+	SIGMA_MATH_EXPRESSION_SCALAR_OPERATOR(operator *)
+	SIGMA_MATH_EXPRESSION_SCALAR_OPERATOR(operator /)
+	SIGMA_MATH_EXPRESSION_SCALAR_OPERATOR(min)
+	SIGMA_MATH_EXPRESSION_SCALAR_OPERATOR(max)
+
+#undef		SIGMA_MATH_EXPRESSION_SCALAR_OPERATOR
+
+	//		**	EVALUATION **
+
+	namespace detail
+	{
+		//	output[i] = expression[i] in one pass, whole packs then scalar remainder
+
+		template <typename Type_, typename Expression_>
+		inline void evaluate(const Expression_ & expression, Type_ * output, std::size_t size)
+		{
+			using pack_t = native_pack_t<Type_>;
+			using scalar_t = Pack<Type_, isa::Scalar>;
+
+			std::size_t index = 0;
+			if constexpr (pack_t::width > 1)
+				for (; index + pack_t::width <= size; index += pack_t::width)
+					expression.template load<pack_t>(index).store(output + index);
+
+			for (; index < size; ++index)
+				expression.template load<scalar_t>(index).store(output + index);
+		}
+
+		template <typename Expression_>
+		inline auto accumulate(const Expression_ & expression, std::size_t size)
+		{
+			using value_t = typename Expression_::value_t;
+			using pack_t = native_pack_t<value_t>;
+			using scalar_t = Pack<value_t, isa::Scalar>;
+
+			std::size_t index = 0;
+			value_t result{};
+
+			if constexpr (pack_t::width > 1)
+			{
+				auto accumulator = pack_t::zero();
+				for (; index + pack_t::width <= size; index += pack_t::width)
+					accumulator = accumulator + expression.template load<pack_t>(index);
+				result = hsum(accumulator);
+			}
+
+			for (; index < size; ++index)
+				result += expression.template load<scalar_t>(index).value;
+			return result;
+		}
+	}
+
+	//	sum of every element, the expression is never materialised
+
+	template <typename Derived_>
+	inline auto sum(const Expression<Derived_> & expression)
+	{
+		const auto root = detail::node(expression);
+		if (root.size() == any_size) throw std::invalid_argument("expression has no array operand");
+		return detail::accumulate(root, root.size());
+	}
+
+	template <typename LHS_, typename RHS_>
+	inline auto dot(const Expression<LHS_> & lhs, const Expression<RHS_> & rhs) { return sum(lhs * rhs); }
+}
+
+#endif	//	_SIGMA_API_MATH_CONTAINER_EXPRESSION_HPP_
\ No newline at end of file
@@ -0,0 +1,172 @@
+#ifndef		_SIGMA_API_MATH_CONTAINER_MATRIX_HPP_
+#define		_SIGMA_API_MATH_CONTAINER_MATRIX_HPP_
+
+#include <cstddef>
+#include <type_traits>
+#include "vector.hpp"
+
+namespace sigma::math
+{
+	//	Fixed size row-major matrix, element-wise kernels run over the whole
+	//	storage and products vectorise along the rows of the right operand
+
+	template <typename Type_, std::size_t rows_, std::size_t columns_>
+	class Matrix
+	{
+		static_assert(rows_ != 0 && columns_ != 0, "matrix requires elements");
+		static_assert(meta::is_arithmetic(meta::type_c<Type_>), "matrix requires arithmetic elements");
+
+	public:
+
+		using value_t = Type_;
+		using row_t = Vector<Type_, columns_>;
+		using column_t = Vector<Type_, rows_>;
+
+		//	element-wise operations
+		using pack_t = native_pack_t<Type_, rows_ * columns_>;
+
+		//	operations along a row
+		using row_pack_t = typename row_t::pack_t;
+
+	private:
+
+		alignas(pack_t) Type_ data_[rows_ * columns_] = {};
+
+		template <typename Function_, typename... Inputs_>
+		static constexpr Matrix map(Function_ function, const Inputs_ &... inputs)
+		{
+			Matrix result;
+			detail::map<pack_t>(rows_ * columns_, function, result.data_, inputs.data()...);
+			return result;
+		}
+
+	public:
+
+		static constexpr std::size_t rows(void) { return rows_; }
+		static constexpr std::size_t columns(void) { return columns_; }
+		static constexpr std::size_t size(void) { return rows_ * columns_; }
+
+		constexpr Matrix(void) = default;
+
+		//	row-major values
+		template <typename... Values_, typename = std::enable_if_t<sizeof...(Values_) == rows_ * columns_>>
+		constexpr Matrix(Values_... values) : data_{ static_cast<Type_>(values)... } {}
+
+		static constexpr Matrix broadcast(Type_ value)
+		{
+			Matrix result;
+			for (auto & element : result.data_) element = value;
+			return result;
+		}
+
+		static constexpr Matrix zero(void) { return Matrix{}; }
+
+		static constexpr Matrix identity(void)
+		{
+			static_assert(rows_ == columns_, "identity requires a square matrix");
+			Matrix result;
+			for (std::size_t index = 0; index < rows_; ++index) result(index, index) = Type_{ 1 };
+			return result;
+		}
+
+		constexpr Type_ & operator() (std::size_t row, std::size_t column) { return data_[row * columns_ + column]; }
+		constexpr const Type_ & operator() (std::size_t row, std::size_t column) const { return data_[row * columns_ + column]; }
+
+		constexpr Type_ * data(void) { return data_; }
+		constexpr const Type_ * data(void) const { return data_; }
+
+		constexpr row_t row(std::size_t index) const
+		{
+			row_t result;
+			for (std::size_t column = 0; column < columns_; ++column) result[column] = (*this)(index, column);
+			return result;
+		}
+
+		constexpr column_t column(std::size_t index) const
+		{
+			column_t result;
+			for (std::size_t row = 0; row < rows_; ++row) result[row] = (*this)(row, index);
+			return result;
+		}
+
+		//		**	ELEMENT-WISE **
+
+		friend constexpr Matrix operator + (const Matrix & lhs, const Matrix & rhs)
+		{ return map([](auto lhs, auto rhs) { return lhs + rhs; }, lhs, rhs); }
+
+		friend constexpr Matrix operator - (const Matrix & lhs, const Matrix & rhs)
+		{ return map([](auto lhs, auto rhs) { return lhs - rhs; }, lhs, rhs); }
+
+		friend constexpr Matrix operator - (const Matrix & matrix)
+		{ return map([](auto value) { return -value; }, matrix); }
+
+		friend constexpr Matrix operator * (const Matrix & matrix, Type_ scalar)
+		{ return map([](auto lhs, auto rhs) { return lhs * rhs; }, matrix, broadcast(scalar)); }
+
+		friend constexpr Matrix operator * (Type_ scalar, const Matrix & matrix) { return matrix * scalar; }
+
+		friend constexpr Matrix operator / (const Matrix & matrix, Type_ scalar)
+		{ return map([](auto lhs, auto rhs) { return lhs / rhs; }, matrix, broadcast(scalar)); }
+
+		//	Hadamard product
+		friend constexpr Matrix hadamard(const Matrix & lhs, const Matrix & rhs)
+		{ return map([](auto lhs, auto rhs) { return lhs * rhs; }, lhs, rhs); }
+
+		constexpr Matrix & operator += (const Matrix & other) { return *this = *this + other; }
+		constexpr Matrix & operator -= (const Matrix & other) { return *this = *this - other; }
+		constexpr Matrix & operator *= (Type_ scalar) { return *this = *this * scalar; }
+		constexpr Matrix & operator /= (Type_ scalar) { return *this = *this / scalar; }
+
+		friend constexpr bool operator == (const Matrix & lhs, const Matrix & rhs)
+		{
+			for (std::size_t index = 0; index < rows_ * columns_; ++index)
+				if (!(lhs.data_[index] == rhs.data_[index])) return false;
+			return true;
+		}
+
+		friend constexpr bool operator != (const Matrix & lhs, const Matrix & rhs) { return !(lhs == rhs); }
+
+		//		**	PRODUCTS **
+
+		//	row i of the result accumulates lhs(i, k) * rhs.row(k), so every
+		//	step is a broadcast and a packed fma along the row
+
+		template <std::size_t other_columns_>
+		friend constexpr Matrix<Type_, rows_, other_columns_>
+			operator * (const Matrix & lhs, const Matrix<Type_, columns_, other_columns_> & rhs)
+		{
+			using result_t = Matrix<Type_, rows_, other_columns_>;
+			using pack_t = typename result_t::row_pack_t;
+
+			result_t result;
+			for (std::size_t row = 0; row < rows_; ++row)
+			{
+				Type_ * output = result.data() + row * other_columns_;
+				for (std::size_t inner = 0; inner < columns_; ++inner)
+					detail::axpy<pack_t>(other_columns_, lhs(row, inner), rhs.data() + inner * other_columns_, output);
+			}
+			return result;
+		}
+
+		friend constexpr column_t operator * (const Matrix & lhs, const row_t & rhs)
+		{
+			column_t result;
+			for (std::size_t row = 0; row < rows_; ++row)
+				result[row] = detail::reduce<row_pack_t>(columns_,
+					[](auto accumulator, auto lhs, auto rhs) { return fma(lhs, rhs, accumulator); },
+					lhs.data_ + row * columns_, rhs.data());
+			return result;
+		}
+
+		friend constexpr Matrix<Type_, columns_, rows_> transpose(const Matrix & matrix)
+		{
+			Matrix<Type_, columns_, rows_> result;
+			for (std::size_t row = 0; row < rows_; ++row)
+				for (std::size_t column = 0; column < columns_; ++column)
+					result(column, row) = matrix(row, column);
+			return result;
+		}
+	};
+}
+
+#endif	//	_SIGMA_API_MATH_CONTAINER_MATRIX_HPP_
\ No newline at end of file
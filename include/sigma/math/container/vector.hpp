@@ -0,0 +1,150 @@
+#ifndef		_SIGMA_API_MATH_CONTAINER_VECTOR_HPP_
+#define		_SIGMA_API_MATH_CONTAINER_VECTOR_HPP_
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include "../simd/pack.hpp"
+
+namespace sigma::math
+{
+	//	Fixed size vector, element-wise kernels run on the widest
+	//	pack of Type_ that fits size_ elements with a scalar remainder
+
+	template <typename Type_, std::size_t size_>
+	class Vector
+	{
+		static_assert(size_ != 0, "vector requires elements");
+		static_assert(meta::is_arithmetic(meta::type_c<Type_>), "vector requires arithmetic elements");
+
+	public:
+
+		using value_t = Type_;
+		using isa_t = typename decltype(select_isa(meta::type_c<Type_>, std::integral_constant<std::size_t, size_>{}))::type_t;
+		using pack_t = Pack<Type_, isa_t>;
+
+	private:
+
+		alignas(pack_t) Type_ data_[size_] = {};
+
+		template <typename Function_, typename... Inputs_>
+		static constexpr Vector map(Function_ function, const Inputs_ &... inputs)
+		{
+			Vector result;
+			detail::map<pack_t>(size_, function, result.data_, inputs.data()...);
+			return result;
+		}
+
+	public:
+
+		static constexpr std::size_t size(void) { return size_; }
+
+		constexpr Vector(void) = default;
+
+		template <typename... Values_, typename = std::enable_if_t<sizeof...(Values_) == size_>>
+		constexpr Vector(Values_... values) : data_{ static_cast<Type_>(values)... } {}
+
+		static constexpr Vector broadcast(Type_ value)
+		{
+			Vector result;
+			for (auto & element : result.data_) element = value;
+			return result;
+		}
+
+		static constexpr Vector zero(void) { return Vector{}; }
+
+		constexpr Type_ & operator[] (std::size_t index) { return data_[index]; }
+		constexpr const Type_ & operator[] (std::size_t index) const { return data_[index]; }
+
+		constexpr Type_ * data(void) { return data_; }
+		constexpr const Type_ * data(void) const { return data_; }
+
+		constexpr Type_ * begin(void) { return data_; }
+		constexpr Type_ * end(void) { return data_ + size_; }
+		constexpr const Type_ * begin(void) const { return data_; }
+		constexpr const Type_ * end(void) const { return data_ + size_; }
+
+		//		**	ELEMENT-WISE **
+
+		friend constexpr Vector operator + (const Vector & lhs, const Vector & rhs)
+		{ return map([](auto lhs, auto rhs) { return lhs + rhs; }, lhs, rhs); }
+
+		friend constexpr Vector operator - (const Vector & lhs, const Vector & rhs)
+		{ return map([](auto lhs, auto rhs) { return lhs - rhs; }, lhs, rhs); }
+
+		friend constexpr Vector operator * (const Vector & lhs, const Vector & rhs)
+		{ return map([](auto lhs, auto rhs) { return lhs * rhs; }, lhs, rhs); }
+
+		friend constexpr Vector operator / (const Vector & lhs, const Vector & rhs)
+		{ return map([](auto lhs, auto rhs) { return lhs / rhs; }, lhs, rhs); }
+
+		friend constexpr Vector operator - (const Vector & vector)
+		{ return map([](auto value) { return -value; }, vector); }
+
+		friend constexpr Vector operator * (const Vector & vector, Type_ scalar)
+		{ return vector * broadcast(scalar); }
+
+		friend constexpr Vector operator * (Type_ scalar, const Vector & vector)
+		{ return broadcast(scalar) * vector; }
+
+		friend constexpr Vector operator / (const Vector & vector, Type_ scalar)
+		{ return vector / broadcast(scalar); }
+
+		friend constexpr Vector min(const Vector & lhs, const Vector & rhs)
+		{ return map([](auto lhs, auto rhs) { return min(lhs, rhs); }, lhs, rhs); }
+
+		friend constexpr Vector max(const Vector & lhs, const Vector & rhs)
+		{ return map([](auto lhs, auto rhs) { return max(lhs, rhs); }, lhs, rhs); }
+
+		//	lhs * rhs + addend
+		friend constexpr Vector fma(const Vector & lhs, const Vector & rhs, const Vector & addend)
+		{ return map([](auto lhs, auto rhs, auto addend) { return fma(lhs, rhs, addend); }, lhs, rhs, addend); }
+
+		constexpr Vector & operator += (const Vector & other) { return *this = *this + other; }
+		constexpr Vector & operator -= (const Vector & other) { return *this = *this - other; }
+		constexpr Vector & operator *= (const Vector & other) { return *this = *this * other; }
+		constexpr Vector & operator /= (const Vector & other) { return *this = *this / other; }
+		constexpr Vector & operator *= (Type_ scalar) { return *this = *this * scalar; }
+		constexpr Vector & operator /= (Type_ scalar) { return *this = *this / scalar; }
+
+		friend constexpr bool operator == (const Vector & lhs, const Vector & rhs)
+		{
+			for (std::size_t index = 0; index < size_; ++index)
+				if (!(lhs.data_[index] == rhs.data_[index])) return false;
+			return true;
+		}
+
+		friend constexpr bool operator != (const Vector & lhs, const Vector & rhs) { return !(lhs == rhs); }
+
+		//		**	REDUCTIONS **
+
+		friend constexpr Type_ sum(const Vector & vector)
+		{
+			return detail::reduce<pack_t>(size_,
+				[](auto accumulator, auto value) { return accumulator + value; }, vector.data_);
+		}
+
+		friend constexpr Type_ dot(const Vector & lhs, const Vector & rhs)
+		{
+			return detail::reduce<pack_t>(size_,
+				[](auto accumulator, auto lhs, auto rhs) { return fma(lhs, rhs, accumulator); }, lhs.data_, rhs.data_);
+		}
+
+		friend Type_ norm(const Vector & vector) { return std::sqrt(dot(vector, vector)); }
+	};
+
+	template <typename Type_, typename... Types_>
+	Vector(Type_, Types_...) -> Vector<Type_, 1 + sizeof...(Types_)>;
+
+	//	3 dimensional cross product
+	template <typename Type_>
+	inline constexpr Vector<Type_, 3> cross(const Vector<Type_, 3> & lhs, const Vector<Type_, 3> & rhs)
+	{
+		return Vector<Type_, 3>(
+			lhs[1] * rhs[2] - lhs[2] * rhs[1],
+			lhs[2] * rhs[0] - lhs[0] * rhs[2],
+			lhs[0] * rhs[1] - lhs[1] * rhs[0]);
+	}
+}
+
+#endif	//	_SIGMA_API_MATH_CONTAINER_VECTOR_HPP_
\ No newline at end of file
@@ -0,0 +1,456 @@
+#ifndef		_SIGMA_API_MATH_SIMD_PACK_HPP_
+#define		_SIGMA_API_MATH_SIMD_PACK_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include <sigma/meta/container/traits.hpp>
+#include <sigma/meta/container/vector.hpp>
+#include <sigma/meta/algorithm/transform.hpp>
+
+namespace sigma::math
+{
+	//*******************************************
+	//			instruction sets
+	//*******************************************
+
+	namespace isa
+	{
+		struct Scalar {};
+		struct SSE {};
+		struct AVX2 {};
+		struct AVX512 {};
+	}
+
+	//	availability follows the target flags of the translation unit,
+	//	e.g. -march=native, so the selection is fixed at compile time
+
+	inline constexpr bool is_available(meta::Type<isa::Scalar>) { return true; }
+
+	inline constexpr bool is_available(meta::Type<isa::SSE>)
+	{
+#if defined(__SSE2__)
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	inline constexpr bool is_available(meta::Type<isa::AVX2>)
+	{
+#if defined(__AVX2__)
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	inline constexpr bool is_available(meta::Type<isa::AVX512>)
+	{
+#if defined(__AVX512F__)
+		return true;
+#else
+		return false;
+#endif
+	}
+
+	inline constexpr std::size_t register_size(meta::Type<isa::Scalar>) { return 0; }
+	inline constexpr std::size_t register_size(meta::Type<isa::SSE>) { return 16; }
+	inline constexpr std::size_t register_size(meta::Type<isa::AVX2>) { return 32; }
+	inline constexpr std::size_t register_size(meta::Type<isa::AVX512>) { return 64; }
+
+	//	widest first
+	inline constexpr auto isa_candidates = meta::TVector<isa::AVX512, isa::AVX2, isa::SSE>{};
+
+	//	vector kernels exist for float and double only
+
+	template <typename Type_>
+	inline constexpr bool is_vectorisable(meta::Type<Type_> type)
+	{ return meta::is_same(type, meta::type_c<float>) || meta::is_same(type, meta::type_c<double>); }
+
+	template <typename Type_, typename Isa_>
+	inline constexpr std::size_t pack_width(meta::Type<Type_> type, meta::Type<Isa_> isa)
+	{
+		if constexpr (!is_vectorisable(type) || register_size(isa) == 0) return 1;
+		else return register_size(isa) / sizeof(Type_);
+	}
+
+	//	widest available instruction set whose pack fits within size_ elements
+
+	template <typename Type_, std::size_t size_>
+	inline constexpr auto select_isa(meta::Type<Type_>, std::integral_constant<std::size_t, size_>)
+	{
+		constexpr auto usable = meta::filter(isa_candidates, [](auto isa)
+		{
+			return !(is_available(isa) && is_vectorisable(meta::type_c<Type_>)
+				&& pack_width(meta::type_c<Type_>, isa) <= size_);
+		});
+
+		if constexpr (usable.size() == 0) return meta::type_c<isa::Scalar>;
+		else return usable.front();
+	}
+
+	template <typename Type_>
+	inline constexpr auto select_isa(meta::Type<Type_> type)
+	{ return select_isa(type, std::integral_constant<std::size_t, static_cast<std::size_t>(-1)>{}); }
+
+	//*******************************************
+	//			packs
+	//*******************************************
+
+	//	Pack<Type_, Isa_> wraps one register of Type_ lanes, all packs share
+	//	the interface below so kernels are written once against it
+
+	template <typename Type_, typename Isa_>
+	struct Pack;
+
+	template <typename Type_>
+	struct Pack<Type_, isa::Scalar>
+	{
+		using value_t = Type_;
+		using register_t = Type_;
+
+		static constexpr std::size_t width = 1;
+
+		register_t value;
+
+		static constexpr Pack load(const value_t * data) { return { *data }; }
+		static constexpr Pack broadcast(value_t value) { return { value }; }
+		static constexpr Pack zero(void) { return { value_t{} }; }
+
+		constexpr void store(value_t * data) const { *data = value; }
+
+		friend constexpr Pack operator + (Pack lhs, Pack rhs) { return { lhs.value + rhs.value }; }
+		friend constexpr Pack operator - (Pack lhs, Pack rhs) { return { lhs.value - rhs.value }; }
+		friend constexpr Pack operator * (Pack lhs, Pack rhs) { return { lhs.value * rhs.value }; }
+		friend constexpr Pack operator / (Pack lhs, Pack rhs) { return { lhs.value / rhs.value }; }
+		friend constexpr Pack operator - (Pack pack) { return { -pack.value }; }
+
+		friend constexpr Pack min(Pack lhs, Pack rhs) { return { rhs.value < lhs.value ? rhs.value : lhs.value }; }
+		friend constexpr Pack max(Pack lhs, Pack rhs) { return { lhs.value < rhs.value ? rhs.value : lhs.value }; }
+
+		//	lhs * rhs + addend
+		friend constexpr Pack fma(Pack lhs, Pack rhs, Pack addend) { return { lhs.value * rhs.value + addend.value }; }
+
+		friend constexpr value_t hsum(Pack pack) { return pack.value; }
+
+		//	bitwise operations act on the lane bit patterns, masks have
+		//	every bit of a lane set or clear
+
+		using bits_t = std::conditional_t<sizeof(Type_) == 8, std::uint64_t, std::uint32_t>;
+
+		static constexpr bits_t to_bits(Pack pack) { return __builtin_bit_cast(bits_t, pack.value); }
+		static constexpr Pack from_bits(bits_t bits) { return { __builtin_bit_cast(value_t, bits) }; }
+
+		friend constexpr Pack operator & (Pack lhs, Pack rhs) { return from_bits(to_bits(lhs) & to_bits(rhs)); }
+		friend constexpr Pack operator | (Pack lhs, Pack rhs) { return from_bits(to_bits(lhs) | to_bits(rhs)); }
+		friend constexpr Pack operator ^ (Pack lhs, Pack rhs) { return from_bits(to_bits(lhs) ^ to_bits(rhs)); }
+
+		//	~lhs & rhs
+		friend constexpr Pack andnot(Pack lhs, Pack rhs) { return from_bits(~to_bits(lhs) & to_bits(rhs)); }
+
+		template <std::size_t count_>
+		friend constexpr Pack shift_left(Pack pack, std::integral_constant<std::size_t, count_>)
+		{ return from_bits(static_cast<bits_t>(to_bits(pack) << count_)); }
+
+		template <std::size_t count_>
+		friend constexpr Pack shift_right(Pack pack, std::integral_constant<std::size_t, count_>)
+		{ return from_bits(static_cast<bits_t>(to_bits(pack) >> count_)); }
+
+		friend constexpr Pack less(Pack lhs, Pack rhs) { return from_bits(lhs.value < rhs.value ? ~bits_t{} : bits_t{}); }
+		friend constexpr Pack equal(Pack lhs, Pack rhs) { return from_bits(lhs.value == rhs.value ? ~bits_t{} : bits_t{}); }
+
+		friend constexpr Pack select(Pack mask, Pack lhs, Pack rhs) { return to_bits(mask) ? lhs : rhs; }
+
+		//	whether any lane of the mask is set
+		friend constexpr bool any(Pack mask) { return to_bits(mask) != 0; }
+	};
+
+	//	the arithmetic interface is identical across register widths up to the
+	//	intrinsic prefix and suffix, e.g. _mm256_add_ps
+
+#define		SIGMA_MATH_PACK_ARITHMETIC(prefix_, suffix_)															\
+		static Pack load(const value_t * data) { return { prefix_##_loadu_##suffix_(data) }; }						\
+		static Pack broadcast(value_t value) { return { prefix_##_set1_##suffix_(value) }; }						\
+		static Pack zero(void) { return { prefix_##_setzero_##suffix_() }; }										\
+																													\
+		void store(value_t * data) const { prefix_##_storeu_##suffix_(data, value); }								\
+																													\
+		friend Pack operator + (Pack lhs, Pack rhs) { return { prefix_##_add_##suffix_(lhs.value, rhs.value) }; }	\
+		friend Pack operator - (Pack lhs, Pack rhs) { return { prefix_##_sub_##suffix_(lhs.value, rhs.value) }; }	\
+		friend Pack operator * (Pack lhs, Pack rhs) { return { prefix_##_mul_##suffix_(lhs.value, rhs.value) }; }	\
+		friend Pack operator / (Pack lhs, Pack rhs) { return { prefix_##_div_##suffix_(lhs.value, rhs.value) }; }	\
+		friend Pack operator - (Pack pack) { return Pack::zero() - pack; }											\
+																													\
+		friend Pack min(Pack lhs, Pack rhs) { return { prefix_##_min_##suffix_(lhs.value, rhs.value) }; }			\
+		friend Pack max(Pack lhs, Pack rhs) { return { prefix_##_max_##suffix_(lhs.value, rhs.value) }; }			\
+																													\
+		friend value_t hsum(Pack pack)																				\
+		{																											\
+			value_t lanes[width];																					\
+			pack.store(lanes);																						\
+			value_t result = 0;																						\
+			for (value_t lane : lanes) result += lane;																\
+			return result;																							\
+		}
+
+	//	bitwise operations go through the integer view of the register,
+	//	e.g. _mm256_castps_si256 then _mm256_and_si256, lanes are shifted
+	//	as 32 or 64 bit integers
+
+#define		SIGMA_MATH_PACK_BITWISE(prefix_, suffix_, integer_, lane_)												\
+		using bits_t = decltype(prefix_##_cast##suffix_##_##integer_(register_t{}));								\
+																													\
+		static bits_t to_bits(Pack pack) { return prefix_##_cast##suffix_##_##integer_(pack.value); }				\
+		static Pack from_bits(bits_t bits) { return { prefix_##_cast##integer_##_##suffix_(bits) }; }				\
+																													\
+		friend Pack operator & (Pack lhs, Pack rhs) { return from_bits(prefix_##_and_##integer_(to_bits(lhs), to_bits(rhs))); }	\
+		friend Pack operator | (Pack lhs, Pack rhs) { return from_bits(prefix_##_or_##integer_(to_bits(lhs), to_bits(rhs))); }	\
+		friend Pack operator ^ (Pack lhs, Pack rhs) { return from_bits(prefix_##_xor_##integer_(to_bits(lhs), to_bits(rhs))); }	\
+		friend Pack andnot(Pack lhs, Pack rhs) { return from_bits(prefix_##_andnot_##integer_(to_bits(lhs), to_bits(rhs))); }	\
+																													\
+		template <std::size_t count_>																				\
+		friend Pack shift_left(Pack pack, std::integral_constant<std::size_t, count_>)								\
+		{ return from_bits(prefix_##_slli_##lane_(to_bits(pack), count_)); }										\
+																													\
+		template <std::size_t count_>																				\
+		friend Pack shift_right(Pack pack, std::integral_constant<std::size_t, count_>)							\
+		{ return from_bits(prefix_##_srli_##lane_(to_bits(pack), count_)); }										\
+																													\
+		friend Pack select(Pack mask, Pack lhs, Pack rhs) { return (mask & lhs) | andnot(mask, rhs); }
+
+#if defined(__FMA__) || defined(__AVX512F__)
+#define		SIGMA_MATH_PACK_FMA(prefix_, suffix_)																	\
+		friend Pack fma(Pack lhs, Pack rhs, Pack addend)															\
+		{ return { prefix_##_fmadd_##suffix_(lhs.value, rhs.value, addend.value) }; }
+#else
+#define		SIGMA_MATH_PACK_FMA(prefix_, suffix_)																	\
+		friend Pack fma(Pack lhs, Pack rhs, Pack addend) { return lhs * rhs + addend; }
+#endif
+
+#if defined(__SSE2__)
+	template <>
+	struct Pack<float, isa::SSE>
+	{
+		using value_t = float;
+		using register_t = __m128;
+
+		static constexpr std::size_t width = 4;
+
+		register_t value;
+
+		SIGMA_MATH_PACK_ARITHMETIC(_mm, ps)
+		SIGMA_MATH_PACK_FMA(_mm, ps)
+		SIGMA_MATH_PACK_BITWISE(_mm, ps, si128, epi32)
+
+		friend Pack less(Pack lhs, Pack rhs) { return { _mm_cmplt_ps(lhs.value, rhs.value) }; }
+		friend Pack equal(Pack lhs, Pack rhs) { return { _mm_cmpeq_ps(lhs.value, rhs.value) }; }
+		friend bool any(Pack mask) { return _mm_movemask_ps(mask.value) != 0; }
+	};
+
+	template <>
+	struct Pack<double, isa::SSE>
+	{
+		using value_t = double;
+		using register_t = __m128d;
+
+		static constexpr std::size_t width = 2;
+
+		register_t value;
+
+		SIGMA_MATH_PACK_ARITHMETIC(_mm, pd)
+		SIGMA_MATH_PACK_FMA(_mm, pd)
+		SIGMA_MATH_PACK_BITWISE(_mm, pd, si128, epi64)
+
+		friend Pack less(Pack lhs, Pack rhs) { return { _mm_cmplt_pd(lhs.value, rhs.value) }; }
+		friend Pack equal(Pack lhs, Pack rhs) { return { _mm_cmpeq_pd(lhs.value, rhs.value) }; }
+		friend bool any(Pack mask) { return _mm_movemask_pd(mask.value) != 0; }
+	};
+#endif
+
+#if defined(__AVX2__)
+	template <>
+	struct Pack<float, isa::AVX2>
+	{
+		using value_t = float;
+		using register_t = __m256;
+
+		static constexpr std::size_t width = 8;
+
+		register_t value;
+
+		SIGMA_MATH_PACK_ARITHMETIC(_mm256, ps)
+		SIGMA_MATH_PACK_FMA(_mm256, ps)
+		SIGMA_MATH_PACK_BITWISE(_mm256, ps, si256, epi32)
+
+		friend Pack less(Pack lhs, Pack rhs) { return { _mm256_cmp_ps(lhs.value, rhs.value, _CMP_LT_OQ) }; }
+		friend Pack equal(Pack lhs, Pack rhs) { return { _mm256_cmp_ps(lhs.value, rhs.value, _CMP_EQ_OQ) }; }
+		friend bool any(Pack mask) { return _mm256_movemask_ps(mask.value) != 0; }
+	};
+
+	template <>
+	struct Pack<double, isa::AVX2>
+	{
+		using value_t = double;
+		using register_t = __m256d;
+
+		static constexpr std::size_t width = 4;
+
+		register_t value;
+
+		SIGMA_MATH_PACK_ARITHMETIC(_mm256, pd)
+		SIGMA_MATH_PACK_FMA(_mm256, pd)
+		SIGMA_MATH_PACK_BITWISE(_mm256, pd, si256, epi64)
+
+		friend Pack less(Pack lhs, Pack rhs) { return { _mm256_cmp_pd(lhs.value, rhs.value, _CMP_LT_OQ) }; }
+		friend Pack equal(Pack lhs, Pack rhs) { return { _mm256_cmp_pd(lhs.value, rhs.value, _CMP_EQ_OQ) }; }
+		friend bool any(Pack mask) { return _mm256_movemask_pd(mask.value) != 0; }
+	};
+#endif
+
+#if defined(__AVX512F__)
+	template <>
+	struct Pack<float, isa::AVX512>
+	{
+		using value_t = float;
+		using register_t = __m512;
+
+		static constexpr std::size_t width = 16;
+
+		register_t value;
+
+		SIGMA_MATH_PACK_ARITHMETIC(_mm512, ps)
+		SIGMA_MATH_PACK_FMA(_mm512, ps)
+		SIGMA_MATH_PACK_BITWISE(_mm512, ps, si512, epi32)
+
+		//	comparisons yield mask registers, widened back to lane masks
+		static Pack widen(__mmask16 mask) { return from_bits(_mm512_maskz_set1_epi32(mask, -1)); }
+
+		friend Pack less(Pack lhs, Pack rhs) { return widen(_mm512_cmp_ps_mask(lhs.value, rhs.value, _CMP_LT_OQ)); }
+		friend Pack equal(Pack lhs, Pack rhs) { return widen(_mm512_cmp_ps_mask(lhs.value, rhs.value, _CMP_EQ_OQ)); }
+		friend bool any(Pack mask) { return _mm512_test_epi32_mask(to_bits(mask), to_bits(mask)) != 0; }
+	};
+
+	template <>
+	struct Pack<double, isa::AVX512>
+	{
+		using value_t = double;
+		using register_t = __m512d;
+
+		static constexpr std::size_t width = 8;
+
+		register_t value;
+
+		SIGMA_MATH_PACK_ARITHMETIC(_mm512, pd)
+		SIGMA_MATH_PACK_FMA(_mm512, pd)
+		SIGMA_MATH_PACK_BITWISE(_mm512, pd, si512, epi64)
+
+		//	comparisons yield mask registers, widened back to lane masks
+		static Pack widen(__mmask8 mask) { return from_bits(_mm512_maskz_set1_epi64(mask, -1)); }
+
+		friend Pack less(Pack lhs, Pack rhs) { return widen(_mm512_cmp_pd_mask(lhs.value, rhs.value, _CMP_LT_OQ)); }
+		friend Pack equal(Pack lhs, Pack rhs) { return widen(_mm512_cmp_pd_mask(lhs.value, rhs.value, _CMP_EQ_OQ)); }
+		friend bool any(Pack mask) { return _mm512_test_epi64_mask(to_bits(mask), to_bits(mask)) != 0; }
+	};
+#endif
+
+#undef		SIGMA_MATH_PACK_ARITHMETIC
+#undef		SIGMA_MATH_PACK_BITWISE
+#undef		SIGMA_MATH_PACK_FMA
+
+	template <typename Type_, typename Isa_>
+	inline constexpr auto pack_c = meta::type_c<Pack<Type_, Isa_>>;
+
+	//	widest pack for Type_ fitting size_ elements
+
+	template <typename Type_, std::size_t size_ = static_cast<std::size_t>(-1)>
+	using native_pack_t = Pack<Type_,
+		typename decltype(select_isa(meta::type_c<Type_>, std::integral_constant<std::size_t, size_>{}))::type_t>;
+
+	//*******************************************
+	//			kernels
+	//*******************************************
+
+	namespace detail
+	{
+		//	output[i] = function(inputs[i]...) over whole packs of Pack_, the
+		//	remainder and constant evaluation fall back to the scalar pack
+
+		template <typename Pack_, typename Function_, typename Type_, typename... Inputs_>
+		constexpr void map(std::size_t size, Function_ function, Type_ * output, const Inputs_ *... inputs)
+		{
+			using scalar_t = Pack<Type_, isa::Scalar>;
+
+			const std::size_t packed = size - size % Pack_::width;
+			std::size_t tail = 0;
+
+			if constexpr (Pack_::width > 1)
+				if (!__builtin_is_constant_evaluated())
+				{
+					for (std::size_t index = 0; index < packed; index += Pack_::width)
+						function(Pack_::load(inputs + index)...).store(output + index);
+					tail = packed;
+				}
+
+			for (std::size_t index = tail; index < size; ++index)
+				function(scalar_t::load(inputs + index)...).store(output + index);
+		}
+
+		//	sum of function(inputs[i]...), accumulated per lane then reduced
+
+		template <typename Pack_, typename Function_, typename Type_, typename... Inputs_>
+		constexpr Type_ reduce(std::size_t size, Function_ function, const Type_ * first, const Inputs_ *... inputs)
+		{
+			using scalar_t = Pack<Type_, isa::Scalar>;
+
+			const std::size_t packed = size - size % Pack_::width;
+			std::size_t tail = 0;
+			Type_ result{};
+
+			if constexpr (Pack_::width > 1)
+				if (!__builtin_is_constant_evaluated())
+				{
+					auto accumulator = Pack_::zero();
+					for (std::size_t index = 0; index < packed; index += Pack_::width)
+						accumulator = function(accumulator, Pack_::load(first + index), Pack_::load(inputs + index)...);
+					result = hsum(accumulator);
+					tail = packed;
+				}
+
+			auto accumulator = scalar_t::broadcast(result);
+			for (std::size_t index = tail; index < size; ++index)
+				accumulator = function(accumulator, scalar_t::load(first + index), scalar_t::load(inputs + index)...);
+			return accumulator.value;
+		}
+
+		//	output[i] += scalar * input[i]
+
+		template <typename Pack_, typename Type_>
+		constexpr void axpy(std::size_t size, Type_ scalar, const Type_ * input, Type_ * output)
+		{
+			using scalar_t = Pack<Type_, isa::Scalar>;
+
+			const std::size_t packed = size - size % Pack_::width;
+			std::size_t tail = 0;
+
+			if constexpr (Pack_::width > 1)
+				if (!__builtin_is_constant_evaluated())
+				{
+					const auto factor = Pack_::broadcast(scalar);
+					for (std::size_t index = 0; index < packed; index += Pack_::width)
+						fma(factor, Pack_::load(input + index), Pack_::load(output + index)).store(output + index);
+					tail = packed;
+				}
+
+			for (std::size_t index = tail; index < size; ++index)
+				output[index] = fma(scalar_t::broadcast(scalar), scalar_t::load(input + index), scalar_t::load(output + index)).value;
+		}
+	}
+}
+
+#endif	//	_SIGMA_API_MATH_SIMD_PACK_HPP_
\ No newline at end of file
@@ -0,0 +1,135 @@
+#ifndef		_SIGMA_API_MATH_TESTING_BENCHMARK_TEST_HPP_
+#define		_SIGMA_API_MATH_TESTING_BENCHMARK_TEST_HPP_
+
+#include <cassert>
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sigma/math/benchmark/benchmark.hpp>
+#include <sigma/math/benchmark/report.hpp>
+
+using namespace sigma::math;
+
+// robust statistics over the repetitions
+void benchmark_statistics_test(void)
+{
+	assert(benchmark::median({}) == 0);
+	assert(benchmark::median({ 3, 1, 2 }) == 2);
+	assert(benchmark::median({ 4, 1, 3, 2 }) == 2.5);
+
+	//	Test the outlier moves neither figure
+
+	assert(benchmark::median({ 10, 11, 9, 10, 1000 }) == 10);
+	assert(benchmark::median_absolute_deviation({ 10, 11, 9, 10, 1000 }) == 1);
+}
+
+template <std::size_t size_>
+void benchmark_counting(benchmark::State & state)
+{
+	std::size_t total = 0;
+	for (auto _ : state)
+	{
+		for (std::size_t index = 0; index < size_; ++index) total += index;
+		benchmark::do_not_optimize(total);
+	}
+	state.set_items(size_);
+}
+
+// sweeps register one entry per value, runs report what the body declared
+void benchmark_run_test(void)
+{
+	std::vector<benchmark::Benchmark> & registry = benchmark::registry();
+	const std::size_t registered = registry.size();
+
+	benchmark::add("counting", sigma::meta::VVector<std::size_t{ 8 }, std::size_t{ 64 }>{},
+		[](auto size) { return &benchmark_counting<decltype(size)::value>; });
+
+	assert(registry.size() == registered + 2);
+	assert(registry[registered].name == "counting/8" && registry[registered + 1].name == "counting/64");
+
+	benchmark::Options options;
+	options.filter = "counting/";
+	options.repetitions = 3;
+	options.warmup_seconds = 0.001;
+	options.repetition_seconds = 0.0001;
+
+	const std::vector<benchmark::Result> results = benchmark::run(options);
+	registry.resize(registered);
+
+	assert(results.size() == 2);
+	for (const benchmark::Result & result : results)
+	{
+		assert(result.repetitions == 3 && result.iterations > 0);
+		assert(result.minimum_ns > 0 && result.minimum_ns <= result.median_ns);
+	}
+	assert(results[1].items == 64);
+
+	//	Test every counter is exported, null when the host refuses it
+
+	std::ostringstream json;
+	benchmark::write_json(json, results);
+
+	const std::string text = json.str();
+	assert(text.find("\"name\": \"counting/64\"") != std::string::npos);
+	assert(text.find("\"median_ns\": ") != std::string::npos);
+	for (std::size_t counter = 0; counter < benchmark::counter_count; ++counter)
+		assert(text.find('"' + std::string(benchmark::counter_name(counter)) + "\": ") != std::string::npos);
+
+	assert(benchmark::detail::escape("a\"b\\c\n") == "a\\\"b\\\\c\\u000a");
+}
+
+// calibration stops at the iteration cap when the body never takes long enough
+void benchmark_calibration_test(void)
+{
+	benchmark::Options options;
+	options.warmup_seconds = 0;
+	options.repetition_seconds = 1000;
+	options.max_iterations = 5000;
+
+	assert(benchmark::detail::calibrate([](benchmark::State & state) { for (auto _ : state) {} }, options) == 5000);
+
+	options.max_iterations = 0;
+	assert(benchmark::detail::calibrate([](benchmark::State & state) { for (auto _ : state) {} }, options) == 1);
+}
+
+// the state times the loop only, not the setup before it
+void benchmark_region_test(void)
+{
+	const auto setup = [](benchmark::State & state)
+	{
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		for (auto _ : state) {}
+	};
+
+	benchmark::State state(10);
+	const double seconds = benchmark::detail::seconds(setup, state);
+	assert(state.measured() && seconds == state.seconds() && seconds < 0.025);
+
+	//	Test a body that leaves the loop early is timed up to its return
+
+	benchmark::State early(10);
+	benchmark::detail::seconds([](benchmark::State & state) { for (auto _ : state) break; }, early);
+	assert(early.measured());
+
+	//	Test counters are read over the same region
+
+	benchmark::Counters counters;
+	benchmark::State counted(10, &counters);
+	benchmark::detail::seconds(setup, counted);
+
+	const std::size_t cycles = benchmark::counter_index("reference_cycles");
+	assert(counted.sample()[cycles].has_value() == counters.available(cycles));
+}
+
+void benchmark_test_main(void)
+{
+	benchmark_statistics_test();
+	benchmark_run_test();
+	benchmark_calibration_test();
+	benchmark_region_test();
+}
+
+#endif	//	_SIGMA_API_MATH_TESTING_BENCHMARK_TEST_HPP_
\ No newline at end of file
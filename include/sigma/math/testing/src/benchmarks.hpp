@@ -0,0 +1,214 @@
+#ifndef		_SIGMA_API_MATH_TESTING_BENCHMARKS_HPP_
+#define		_SIGMA_API_MATH_TESTING_BENCHMARKS_HPP_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <sigma/math/algorithm/gemm.hpp>
+#include <sigma/math/algorithm/transcendental.hpp>
+#include <sigma/math/benchmark/benchmark.hpp>
+#include <sigma/math/container/array.hpp>
+#include <sigma/meta/algorithm/sorting_network.hpp>
+
+using namespace sigma::math;
+
+//	Kernels timed by sigma_api_math --benchmark, each against the loop it replaces
+
+using benchmark_sizes_t = sigma::meta::VVector<std::size_t{ 1024 }, std::size_t{ 65536 }>;
+
+// input spanning the range the kernels are accurate over
+template <typename Type_>
+std::vector<Type_> benchmark_input(std::size_t size, double lower, double upper)
+{
+	std::vector<Type_> input(size);
+	for (std::size_t index = 0; index < size; ++index)
+		input[index] = static_cast<Type_>(lower + (upper - lower) * index / size);
+	return input;
+}
+
+// runs kernel(size, in, out) once per iteration, one item per element
+template <std::size_t size_, typename Kernel_>
+void benchmark_elementwise(benchmark::State & state, Kernel_ kernel, double lower, double upper)
+{
+	const std::vector<float> input = benchmark_input<float>(size_, lower, upper);
+	std::vector<float> output(size_);
+
+	for (auto _ : state)
+	{
+		kernel(size_, input.data(), output.data());
+		benchmark::do_not_optimize(output.data());
+		benchmark::clobber_memory();
+	}
+	state.set_items(size_);
+	state.set_bytes(2 * size_ * sizeof(float));
+}
+
+// libm through the same loop shape
+template <typename Function_>
+auto benchmark_libm(Function_ function)
+{
+	return [function](std::size_t size, const float * input, float * output)
+	{
+		for (std::size_t index = 0; index < size; ++index) output[index] = function(input[index]);
+	};
+}
+
+SIGMA_BENCHMARK_SWEEP(exp_full, benchmark_sizes_t)
+{
+	benchmark_elementwise<parameter_>(state, [](auto... arguments) { exp(arguments...); }, -80, 80);
+}
+
+SIGMA_BENCHMARK_SWEEP(exp_low, benchmark_sizes_t)
+{
+	benchmark_elementwise<parameter_>(state, [](auto... arguments) { exp<accuracy::Low>(arguments...); }, -80, 80);
+}
+
+SIGMA_BENCHMARK_SWEEP(exp_libm, benchmark_sizes_t)
+{
+	benchmark_elementwise<parameter_>(state, benchmark_libm([](float x) { return std::exp(x); }), -80, 80);
+}
+
+SIGMA_BENCHMARK_SWEEP(log_full, benchmark_sizes_t)
+{
+	benchmark_elementwise<parameter_>(state, [](auto... arguments) { log(arguments...); }, 1e-3, 1e3);
+}
+
+SIGMA_BENCHMARK_SWEEP(log_libm, benchmark_sizes_t)
+{
+	benchmark_elementwise<parameter_>(state, benchmark_libm([](float x) { return std::log(x); }), 1e-3, 1e3);
+}
+
+SIGMA_BENCHMARK_SWEEP(sin_full, benchmark_sizes_t)
+{
+	benchmark_elementwise<parameter_>(state, [](auto... arguments) { sin(arguments...); }, -100, 100);
+}
+
+SIGMA_BENCHMARK_SWEEP(sin_libm, benchmark_sizes_t)
+{
+	benchmark_elementwise<parameter_>(state, benchmark_libm([](float x) { return std::sin(x); }), -100, 100);
+}
+
+SIGMA_BENCHMARK_SWEEP(erf_full, benchmark_sizes_t)
+{
+	benchmark_elementwise<parameter_>(state, [](auto... arguments) { erf(arguments...); }, -5, 5);
+}
+
+SIGMA_BENCHMARK_SWEEP(erf_libm, benchmark_sizes_t)
+{
+	benchmark_elementwise<parameter_>(state, benchmark_libm([](float x) { return std::erf(x); }), -5, 5);
+}
+
+// a * b + c * exp(d) in one pass over the operands
+SIGMA_BENCHMARK_SWEEP(expression_fused, benchmark_sizes_t)
+{
+	const Array<float> a(parameter_, 1.5f), b(parameter_, 2.5f), c(parameter_, 0.5f), d(parameter_, -1.0f);
+	Array<float> result(parameter_);
+
+	for (auto _ : state)
+	{
+		result = a * b + c * exp(d);
+		benchmark::do_not_optimize(result.data());
+		benchmark::clobber_memory();
+	}
+	state.set_items(parameter_);
+}
+
+// single precision flops counted as items, 2 n^3 per product
+SIGMA_BENCHMARK_SWEEP(gemm, sigma::meta::VVector<std::size_t{ 64 }, std::size_t{ 128 }, std::size_t{ 256 },
+	std::size_t{ 512 }>)
+{
+	const std::vector<float> a(parameter_ * parameter_, 1.0f), b(parameter_ * parameter_, 0.5f);
+	std::vector<float> c(parameter_ * parameter_);
+
+	for (auto _ : state)
+	{
+		gemm(parameter_, parameter_, parameter_, a.data(), b.data(), c.data());
+		benchmark::do_not_optimize(c.data());
+		benchmark::clobber_memory();
+	}
+	state.set_items(2 * parameter_ * parameter_ * parameter_);
+}
+
+//	Sorting sizes of the median / top-k path, each iteration sorts a batch of
+//	independent arrays copied from the same random input
+
+using sort_sizes_t = sigma::meta::VVector<std::size_t{ 4 }, std::size_t{ 8 }, std::size_t{ 16 }, std::size_t{ 32 }>;
+
+constexpr std::size_t sort_batch = 1024;
+constexpr std::size_t sort_lanes = 16;
+
+template <std::size_t size_, typename Sort_>
+void benchmark_sort(benchmark::State & state, Sort_ sort)
+{
+	std::vector<float> input(sort_batch * size_), data(input.size());
+
+	std::uint32_t seed = 12345;
+	for (float & value : input)
+	{
+		seed = seed * 1664525u + 1013904223u;
+		value = static_cast<float>(seed >> 8);
+	}
+
+	for (auto _ : state)
+	{
+		std::copy(input.begin(), input.end(), data.begin());
+		sort(data.data());
+		benchmark::do_not_optimize(data.data());
+		benchmark::clobber_memory();
+	}
+	state.set_items(sort_batch * size_);
+}
+
+template <typename Type_>
+void insertion_sort(Type_ * first, Type_ * last)
+{
+	for (Type_ * current = first + 1; current < last; ++current)
+	{
+		const Type_ value = *current;
+		Type_ * hole = current;
+		for (; hole != first && value < hole[-1]; --hole) *hole = hole[-1];
+		*hole = value;
+	}
+}
+
+SIGMA_BENCHMARK_SWEEP(sort_network, sort_sizes_t)
+{
+	benchmark_sort<parameter_>(state, [](float * data)
+	{
+		for (std::size_t array = 0; array < sort_batch; ++array)
+			sigma::meta::network_sort<parameter_>(sigma::meta::sorting_network<parameter_>(), data + array * parameter_);
+	});
+}
+
+// the batch as blocks of sort_lanes arrays stored column-wise
+SIGMA_BENCHMARK_SWEEP(sort_network_lanes, sort_sizes_t)
+{
+	benchmark_sort<parameter_>(state, [](float * data)
+	{
+		for (std::size_t block = 0; block < sort_batch / sort_lanes; ++block)
+			sigma::meta::network_sort_lanes<parameter_, sort_lanes>(data + block * parameter_ * sort_lanes);
+	});
+}
+
+SIGMA_BENCHMARK_SWEEP(sort_std, sort_sizes_t)
+{
+	benchmark_sort<parameter_>(state, [](float * data)
+	{
+		for (std::size_t array = 0; array < sort_batch; ++array)
+			std::sort(data + array * parameter_, data + (array + 1) * parameter_);
+	});
+}
+
+SIGMA_BENCHMARK_SWEEP(sort_insertion, sort_sizes_t)
+{
+	benchmark_sort<parameter_>(state, [](float * data)
+	{
+		for (std::size_t array = 0; array < sort_batch; ++array)
+			insertion_sort(data + array * parameter_, data + (array + 1) * parameter_);
+	});
+}
+
+#endif	//	_SIGMA_API_MATH_TESTING_BENCHMARKS_HPP_
\ No newline at end of file
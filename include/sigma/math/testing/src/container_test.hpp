@@ -0,0 +1,160 @@
+#ifndef		_SIGMA_API_MATH_TESTING_CONTAINER_TEST_HPP_
+#define		_SIGMA_API_MATH_TESTING_CONTAINER_TEST_HPP_
+
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+
+#include <sigma/math/container/vector.hpp>
+#include <sigma/math/container/matrix.hpp>
+
+using namespace sigma::math;
+
+// constexpr Vector tests, constant evaluation takes the scalar path
+void vector_constexpr_test(void)
+{
+	constexpr Vector v1(1.0f, 2.0f, 3.0f);
+	constexpr Vector v2(4.0f, 5.0f, 6.0f);
+
+	//	Test deduction and layout
+
+	static_assert(std::is_same_v<decltype(v1), const Vector<float, 3>>);
+	static_assert(v1.size() == 3);
+	static_assert(sizeof(Vector<double, 5>) >= 5 * sizeof(double));
+	static_assert(alignof(Vector<float, 16>) == alignof(typename Vector<float, 16>::pack_t));
+
+	//	Test element-wise arithmetic
+
+	static_assert(v1 + v2 == Vector(5.0f, 7.0f, 9.0f));
+	static_assert(v2 - v1 == Vector<float, 3>::broadcast(3.0f));
+	static_assert(v1 * v2 == Vector(4.0f, 10.0f, 18.0f));
+	static_assert(v1 * 2.0f == Vector(2.0f, 4.0f, 6.0f));
+	static_assert(-v1 == Vector(-1.0f, -2.0f, -3.0f));
+	static_assert(min(v1, Vector(0.0f, 5.0f, 1.0f)) == Vector(0.0f, 2.0f, 1.0f));
+	static_assert(fma(v1, v2, v1) == Vector(5.0f, 12.0f, 21.0f));
+
+	//	Test reductions
+
+	static_assert(sum(v1) == 6.0f);
+	static_assert(dot(v1, v2) == 32.0f);
+	static_assert(cross(v1, v2) == Vector(-3.0f, 6.0f, -3.0f));
+}
+
+// runtime Vector tests, sizes chosen to cover whole packs and remainders
+template <typename Type_, std::size_t size_>
+void vector_runtime_test(void)
+{
+	Vector<Type_, size_> lhs, rhs;
+	for (std::size_t index = 0; index < size_; ++index)
+	{
+		lhs[index] = static_cast<Type_>(index) + 1;
+		rhs[index] = static_cast<Type_>(size_ - index) * Type_(0.5);
+	}
+
+	const auto added = lhs + rhs;
+	const auto multiplied = lhs * rhs;
+	const auto fused = fma(lhs, rhs, added);
+	const auto largest = max(lhs, rhs);
+
+	Type_ expected_dot = 0;
+	for (std::size_t index = 0; index < size_; ++index)
+	{
+		assert(added[index] == lhs[index] + rhs[index]);
+		assert(multiplied[index] == lhs[index] * rhs[index]);
+		assert(std::abs(fused[index] - (lhs[index] * rhs[index] + added[index])) <= 1e-4 * std::abs(fused[index]));
+		assert(largest[index] == (lhs[index] < rhs[index] ? rhs[index] : lhs[index]));
+		expected_dot += lhs[index] * rhs[index];
+	}
+
+	assert(std::abs(dot(lhs, rhs) - expected_dot) <= 1e-4 * expected_dot);
+	assert(sum(lhs) == static_cast<Type_>(size_ * (size_ + 1) / 2));
+
+	auto accumulated = lhs;
+	accumulated += rhs;
+	accumulated *= Type_(2);
+	assert(accumulated == (lhs + rhs) * Type_(2));
+}
+
+// constexpr Matrix tests
+void matrix_constexpr_test(void)
+{
+	constexpr Matrix<int, 2, 3> m1(1, 2, 3, 4, 5, 6);
+	constexpr Matrix<int, 3, 2> m2(7, 8, 9, 10, 11, 12);
+
+	//	Test shape and access
+
+	static_assert(m1.rows() == 2 && m1.columns() == 3);
+	static_assert(m1(1, 2) == 6);
+	static_assert(m1.row(1) == Vector(4, 5, 6));
+	static_assert(m1.column(0) == Vector(1, 4));
+	static_assert(transpose(m1) == Matrix<int, 3, 2>(1, 4, 2, 5, 3, 6));
+
+	//	Test products
+
+	static_assert(m1 * m2 == Matrix<int, 2, 2>(58, 64, 139, 154));
+	static_assert(m1 * Vector(1, 0, -1) == Vector(-2, -2));
+	static_assert(Matrix<int, 3, 3>::identity() * m2 == m2);
+
+	//	Test element-wise arithmetic
+
+	static_assert(m1 + m1 == m1 * 2);
+	static_assert(hadamard(m1, m1) - m1 == Matrix<int, 2, 3>(0, 2, 6, 12, 20, 30));
+}
+
+// runtime Matrix tests against a naive product
+template <typename Type_, std::size_t rows_, std::size_t inner_, std::size_t columns_>
+void matrix_runtime_test(void)
+{
+	Matrix<Type_, rows_, inner_> lhs;
+	Matrix<Type_, inner_, columns_> rhs;
+	Vector<Type_, inner_> vector;
+
+	for (std::size_t row = 0; row < rows_; ++row)
+		for (std::size_t inner = 0; inner < inner_; ++inner)
+			lhs(row, inner) = static_cast<Type_>((row * 3 + inner) % 7) - 3;
+	for (std::size_t inner = 0; inner < inner_; ++inner)
+	{
+		vector[inner] = static_cast<Type_>(inner % 5);
+		for (std::size_t column = 0; column < columns_; ++column)
+			rhs(inner, column) = static_cast<Type_>((inner + column * 5) % 11) * Type_(0.25);
+	}
+
+	const auto product = lhs * rhs;
+	const auto transformed = lhs * vector;
+
+	for (std::size_t row = 0; row < rows_; ++row)
+	{
+		Type_ expected_row = 0;
+		for (std::size_t inner = 0; inner < inner_; ++inner) expected_row += lhs(row, inner) * vector[inner];
+		assert(transformed[row] == expected_row);
+
+		for (std::size_t column = 0; column < columns_; ++column)
+		{
+			Type_ expected = 0;
+			for (std::size_t inner = 0; inner < inner_; ++inner) expected += lhs(row, inner) * rhs(inner, column);
+			assert(product(row, column) == expected);
+		}
+	}
+
+	assert(transpose(transpose(lhs)) == lhs);
+}
+
+void container_test_main(void)
+{
+	vector_constexpr_test();
+	vector_runtime_test<float, 1>();
+	vector_runtime_test<float, 4>();
+	vector_runtime_test<float, 19>();
+	vector_runtime_test<float, 64>();
+	vector_runtime_test<double, 3>();
+	vector_runtime_test<double, 13>();
+	vector_runtime_test<int, 9>();
+
+	matrix_constexpr_test();
+	matrix_runtime_test<float, 4, 4, 4>();
+	matrix_runtime_test<float, 5, 7, 19>();
+	matrix_runtime_test<double, 16, 16, 16>();
+	matrix_runtime_test<double, 3, 9, 2>();
+}
+
+#endif	//	_SIGMA_API_MATH_TESTING_CONTAINER_TEST_HPP_
\ No newline at end of file
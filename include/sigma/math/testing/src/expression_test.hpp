@@ -0,0 +1,130 @@
+#ifndef		_SIGMA_API_MATH_TESTING_EXPRESSION_TEST_HPP_
+#define		_SIGMA_API_MATH_TESTING_EXPRESSION_TEST_HPP_
+
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+#include <type_traits>
+
+#include <sigma/math/container/array.hpp>
+
+using namespace sigma::math;
+
+// compile time tree shape and simplification
+void expression_shape_test(void)
+{
+	using terminal_t = Terminal<double>;
+	using constant_t = Constant<double>;
+
+	Array<double> a, b, c, d, e;
+
+	//	Test plain nodes
+
+	static_assert(std::is_same_v<decltype(a + b), Node<op::Add, terminal_t, terminal_t>>);
+	static_assert(std::is_same_v<decltype(a / 2.0), Node<op::Div, terminal_t, constant_t>>);
+	static_assert(std::is_same_v<decltype(min(a, 1)), Node<op::Min, terminal_t, constant_t>>);
+
+	//	Test products fused into the neighbouring sum
+
+	using product_t = Node<op::Mul, terminal_t, terminal_t>;
+
+	static_assert(std::is_same_v<decltype(a * b + c), Node<op::Fma, terminal_t, terminal_t, terminal_t>>);
+	static_assert(std::is_same_v<decltype(c + a * b), Node<op::Fma, terminal_t, terminal_t, terminal_t>>);
+	static_assert(std::is_same_v<decltype(a * b + c * d), Node<op::Fma, terminal_t, terminal_t, product_t>>);
+	static_assert(std::is_same_v<decltype(a * b - c),
+		Node<op::Fma, terminal_t, terminal_t, Node<op::Neg, terminal_t>>>);
+	static_assert(std::is_same_v<decltype(c - a * b),
+		Node<op::Fma, Node<op::Neg, terminal_t>, terminal_t, terminal_t>>);
+	static_assert(std::is_same_v<decltype(a * b + c * d - e),
+		Node<op::Sub, Node<op::Fma, terminal_t, terminal_t, product_t>, terminal_t>>);
+
+	//	Test negation and constant folding
+
+	static_assert(std::is_same_v<decltype(-(-a)), terminal_t>);
+	static_assert(std::is_same_v<decltype(a * 2.0 - 1.0), Node<op::Fma, terminal_t, constant_t, constant_t>>);
+	static_assert(is_product(sigma::meta::type_c<product_t>));
+	static_assert(!is_product(sigma::meta::type_c<terminal_t>));
+}
+
+// fused evaluation against element-wise reference loops
+template <typename Type_>
+void expression_evaluation_test(std::size_t size)
+{
+	Array<Type_> a(size), b(size), c(size), d(size), e(size);
+	for (std::size_t index = 0; index < size; ++index)
+	{
+		a[index] = static_cast<Type_>(index % 17) * Type_(0.5);
+		b[index] = static_cast<Type_>(index % 5) - 2;
+		c[index] = static_cast<Type_>(index % 3) + Type_(0.25);
+		d[index] = static_cast<Type_>(index % 7) * Type_(-0.125);
+		e[index] = static_cast<Type_>(index % 11);
+	}
+
+	const Array<Type_> result = a * b + c * d - e;
+	const Array<Type_> clamped = max(min(a - 2, b * 3), Type_(-1)) / 2;
+
+	assert(result.size() == size);
+	for (std::size_t index = 0; index < size; ++index)
+	{
+		const Type_ expected = a[index] * b[index] + c[index] * d[index] - e[index];
+		assert(std::abs(result[index] - expected) <= Type_(1e-5) * (1 + std::abs(expected)));
+
+		Type_ bounded = a[index] - 2 < b[index] * 3 ? a[index] - 2 : b[index] * 3;
+		bounded = bounded < -1 ? Type_(-1) : bounded;
+		assert(clamped[index] == bounded / 2);
+	}
+
+	//	Test aliasing and compound assignment
+
+	Array<Type_> aliased = a;
+	aliased = aliased * aliased + aliased;
+	aliased -= a;
+	aliased *= Type_(2);
+	for (std::size_t index = 0; index < size; ++index)
+		assert(std::abs(aliased[index] - 2 * a[index] * a[index]) <= Type_(1e-5) * (1 + aliased[index]));
+
+	//	Test reductions without materialising
+
+	Type_ expected_sum = 0, expected_dot = 0;
+	for (std::size_t index = 0; index < size; ++index)
+	{
+		expected_sum += a[index] + e[index];
+		expected_dot += a[index] * e[index];
+	}
+
+	assert(std::abs(sum(a + e) - expected_sum) <= Type_(1e-4) * (1 + std::abs(expected_sum)));
+	assert(std::abs(dot(a, e) - expected_dot) <= Type_(1e-4) * (1 + std::abs(expected_dot)));
+}
+
+// operands of different sizes are rejected when the tree is built
+void expression_size_test(void)
+{
+	const Array<float> a(4, 1.0f), b(5, 2.0f);
+
+	bool thrown = false;
+	try { Array<float> result = a + b * 2.0f; }
+	catch (const std::invalid_argument &) { thrown = true; }
+	assert(thrown);
+
+	thrown = false;
+	try { sum(a - a * b); }
+	catch (const std::invalid_argument &) { thrown = true; }
+	assert(thrown);
+
+	Array<float> broadcast = a + 2.0f;
+	assert(broadcast.size() == 4 && broadcast[3] == 3.0f);
+}
+
+void expression_test_main(void)
+{
+	expression_shape_test();
+	expression_size_test();
+
+	for (std::size_t size : { 0, 1, 7, 16, 33, 1000 })
+	{
+		expression_evaluation_test<float>(size);
+		expression_evaluation_test<double>(size);
+	}
+}
+
+#endif	//	_SIGMA_API_MATH_TESTING_EXPRESSION_TEST_HPP_
\ No newline at end of file
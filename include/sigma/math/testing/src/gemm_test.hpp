@@ -0,0 +1,103 @@
+#ifndef		_SIGMA_API_MATH_TESTING_GEMM_TEST_HPP_
+#define		_SIGMA_API_MATH_TESTING_GEMM_TEST_HPP_
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <sigma/math/algorithm/gemm.hpp>
+
+using namespace sigma::math;
+
+template <typename Type_>
+void naive_gemm(std::size_t m, std::size_t n, std::size_t k, const Type_ * a, std::size_t lda,
+	const Type_ * b, std::size_t ldb, Type_ * c, std::size_t ldc)
+{
+	for (std::size_t row = 0; row < m; ++row)
+		for (std::size_t column = 0; column < n; ++column)
+		{
+			Type_ result = c[row * ldc + column];
+			for (std::size_t inner = 0; inner < k; ++inner)
+				result += a[row * lda + inner] * b[inner * ldb + column];
+			c[row * ldc + column] = result;
+		}
+}
+
+// blocked product against the naive triple loop, operands are views into
+// larger matrices so leading dimensions differ from the widths
+template <typename Type_, typename Blocking_>
+void gemm_blocking_test(Blocking_ blocking, std::size_t m, std::size_t n, std::size_t k)
+{
+	const std::size_t lda = k + 3, ldb = n + 1, ldc = n + 5;
+
+	std::vector<Type_> a(m * lda), b(k * ldb), c(m * ldc), expected(m * ldc);
+	for (std::size_t index = 0; index < a.size(); ++index) a[index] = static_cast<Type_>(index % 9) - 4;
+	for (std::size_t index = 0; index < b.size(); ++index) b[index] = static_cast<Type_>(index % 5) * Type_(0.5);
+	for (std::size_t index = 0; index < c.size(); ++index) c[index] = expected[index] = static_cast<Type_>(index % 3);
+
+	gemm(blocking, m, n, k, a.data(), lda, b.data(), ldb, c.data(), ldc);
+	naive_gemm(m, n, k, a.data(), lda, b.data(), ldb, expected.data(), ldc);
+
+	for (std::size_t index = 0; index < c.size(); ++index)
+		assert(std::abs(c[index] - expected[index]) <= Type_(1e-4) * (1 + std::abs(expected[index])));
+}
+
+template <typename Type_, typename... Blockings_>
+void gemm_candidates_test(sigma::meta::TVector<Blockings_...>)
+{
+	for (auto [m, n, k] : { std::array<std::size_t, 3>{ 1, 1, 1 }, { 7, 13, 5 }, { 64, 64, 64 }, { 130, 37, 300 } })
+		(gemm_blocking_test<Type_>(Blockings_{}, m, n, k), ...);
+}
+
+void gemm_test_main(void)
+{
+	//	Test blocking selection
+
+	constexpr auto width = native_pack_t<double>::width;
+	static_assert(default_blocking(sigma::meta::type_c<double>) == Blocking<6, 2 * width, 96, 256, 2048>{});
+	static_assert(gemm_candidates(sigma::meta::type_c<float>).size() == 5);
+
+	//	a tuned overload for another isa is not viable, its tile width may not
+	//	be a multiple of this build's pack width
+
+	static_assert(tuned_blocking(sigma::meta::type_c<double>, sigma::meta::type_c<void>) == default_blocking(sigma::meta::type_c<double>));
+
+	//	Test every candidate and the selected blocking
+
+	gemm_candidates_test<float>(gemm_candidates(sigma::meta::type_c<float>));
+	gemm_candidates_test<double>(gemm_candidates(sigma::meta::type_c<double>));
+	gemm_candidates_test<double>(sigma::meta::TVector<Blocking<2, width, 4, 3, 2 * width>>{});
+	gemm_blocking_test<double>(blocking(sigma::meta::type_c<double>), 65, 65, 65);
+	gemm_blocking_test<int>(blocking(sigma::meta::type_c<int>), 9, 10, 11);
+
+	//	Test dense overload and the autotuner bookkeeping
+
+	std::vector<float> a(6 * 4, 1.0f), b(4 * 5, 2.0f), c(6 * 5, 1.0f);
+	gemm(std::size_t{ 6 }, std::size_t{ 5 }, std::size_t{ 4 }, a.data(), b.data(), c.data());
+	for (float value : c) assert(value == 9.0f);
+
+	const auto timings = autotune<double>(gemm_candidates(sigma::meta::type_c<double>), { 16 }, 1);
+	assert(timings.size() == 5);
+	for (std::size_t index = 0; index < timings.size(); ++index) assert(timings[index].candidate == index);
+
+	//	Test the generated header, tagged with the isa and written in one piece
+
+	const std::string path = "gemm_tuned_test.hpp";
+	std::ofstream(path) << "previous";
+	assert(!write_tuned_header(path + "/missing/gemm_tuned.hpp", { 16 }, 1));
+	assert(write_tuned_header(path, { 16 }, 1));
+
+	std::stringstream header;
+	header << std::ifstream(path).rdbuf();
+	assert(header.str().find("meta::Type<float>, meta::Type<isa::") != std::string::npos);
+	assert(header.str().find("meta::Type<double>, meta::Type<isa::") != std::string::npos);
+	assert(!std::ifstream(path + ".tmp"));
+	std::remove(path.c_str());
+}
+
+#endif	//	_SIGMA_API_MATH_TESTING_GEMM_TEST_HPP_
\ No newline at end of file
@@ -1,2 +1,102 @@
-int main(void)
-{}
\ No newline at end of file
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+#include "simd_test.hpp"
+#include "container_test.hpp"
+#include "expression_test.hpp"
+#include "gemm_test.hpp"
+#include "transcendental_test.hpp"
+#include "benchmark_test.hpp"
+#include "benchmarks.hpp"
+
+//	sigma_api_math						run the test suite
+//	sigma_api_math --tune-gemm [<path>]	time the gemm candidates on this host and
+//										write the winners to <path>, by default
+//										include/sigma/math/algorithm/gemm_tuned.hpp
+//										where gemm.hpp picks them up
+//	sigma_api_math --benchmark [--filter <substring>] [--repetitions <n>] [--json <path>]
+//										time the kernels in benchmarks.hpp, print a
+//										table and optionally write the results as json,
+//										meaningful in a -DCMAKE_BUILD_TYPE=Release build
+
+//	gemm_tuned.hpp next to gemm.hpp, found from the location of this file so
+//	that the default does not depend on the working directory
+std::string tuned_header_path(void)
+{
+	const std::string source = __FILE__;
+	const std::size_t slash = source.find_last_of("/\\");
+	const std::string directory = slash == std::string::npos ? std::string(".") : source.substr(0, slash);
+	return directory + "/../../algorithm/gemm_tuned.hpp";
+}
+
+int run_benchmarks(int argc, char ** argv)
+{
+	sigma::math::benchmark::Options options;
+	const char * json = nullptr;
+
+	for (int index = 2; index < argc; index += 2)
+	{
+		if (index + 1 == argc)
+		{
+			std::fprintf(stderr, "missing value for %s\n", argv[index]);
+			return 1;
+		}
+
+		if (std::strcmp(argv[index], "--filter") == 0) options.filter = argv[index + 1];
+		else if (std::strcmp(argv[index], "--repetitions") == 0)
+		{
+			char * end = nullptr;
+			const unsigned long repetitions = std::strtoul(argv[index + 1], &end, 10);
+			if (!std::isdigit(static_cast<unsigned char>(argv[index + 1][0])) || *end != '\0' || repetitions == 0)
+			{
+				std::fprintf(stderr, "invalid value for --repetitions: %s\n", argv[index + 1]);
+				return 1;
+			}
+			options.repetitions = repetitions;
+		}
+		else if (std::strcmp(argv[index], "--json") == 0) json = argv[index + 1];
+		else
+		{
+			std::fprintf(stderr, "unknown option %s\n", argv[index]);
+			return 1;
+		}
+	}
+
+	const auto results = sigma::math::benchmark::run(options);
+	sigma::math::benchmark::print(std::cout, results);
+
+	if (json && !sigma::math::benchmark::write_json(json, results))
+	{
+		std::fprintf(stderr, "cannot write %s\n", json);
+		return 1;
+	}
+	return 0;
+}
+
+int main(int argc, char ** argv)
+{
+	if (argc > 1 && std::strcmp(argv[1], "--tune-gemm") == 0)
+	{
+		const std::string path = argc > 2 ? argv[2] : tuned_header_path();
+		if (!sigma::math::write_tuned_header(path))
+		{
+			std::fprintf(stderr, "cannot write %s\n", path.c_str());
+			return 1;
+		}
+		std::printf("wrote %s\n", path.c_str());
+		return 0;
+	}
+
+	if (argc > 1 && std::strcmp(argv[1], "--benchmark") == 0) return run_benchmarks(argc, argv);
+
+	simd_test_main();
+	container_test_main();
+	expression_test_main();
+	gemm_test_main();
+	transcendental_test_main();
+	benchmark_test_main();
+}
\ No newline at end of file
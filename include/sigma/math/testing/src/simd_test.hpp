@@ -0,0 +1,145 @@
+#ifndef		_SIGMA_API_MATH_TESTING_SIMD_TEST_HPP_
+#define		_SIGMA_API_MATH_TESTING_SIMD_TEST_HPP_
+
+#include <cassert>
+#include <limits>
+#include <type_traits>
+
+#include <sigma/math/simd/pack.hpp>
+
+using namespace sigma::math;
+using namespace sigma::meta::literals;
+
+// compile time instruction set selection
+void isa_selection_test(void)
+{
+	//	Test non vectorisable types stay scalar
+
+	static_assert(select_isa(sigma::meta::type_c<int>) == sigma::meta::type_c<isa::Scalar>);
+	static_assert(select_isa(sigma::meta::type_c<long double>) == sigma::meta::type_c<isa::Scalar>);
+	static_assert(pack_width(sigma::meta::type_c<int>, sigma::meta::type_c<isa::AVX2>) == 1);
+
+	//	Test pack widths
+
+	static_assert(pack_width(sigma::meta::type_c<float>, sigma::meta::type_c<isa::SSE>) == 4);
+	static_assert(pack_width(sigma::meta::type_c<double>, sigma::meta::type_c<isa::AVX2>) == 4);
+	static_assert(pack_width(sigma::meta::type_c<float>, sigma::meta::type_c<isa::AVX512>) == 16);
+
+	//	Test sizes below the narrowest pack stay scalar
+
+	static_assert(select_isa(sigma::meta::type_c<float>, 3_u) == sigma::meta::type_c<isa::Scalar>);
+	static_assert(select_isa(sigma::meta::type_c<double>, 1_u) == sigma::meta::type_c<isa::Scalar>);
+
+	//	Test the widest available instruction set is chosen
+
+#if defined(__AVX512F__)
+	static_assert(select_isa(sigma::meta::type_c<float>) == sigma::meta::type_c<isa::AVX512>);
+	static_assert(select_isa(sigma::meta::type_c<float>, 15_u) == sigma::meta::type_c<isa::AVX2>);
+	static_assert(native_pack_t<double>::width == 8);
+#elif defined(__AVX2__)
+	static_assert(select_isa(sigma::meta::type_c<float>) == sigma::meta::type_c<isa::AVX2>);
+	static_assert(native_pack_t<double>::width == 4);
+#elif defined(__SSE2__)
+	static_assert(select_isa(sigma::meta::type_c<float>) == sigma::meta::type_c<isa::SSE>);
+	static_assert(native_pack_t<double>::width == 2);
+#endif
+
+	static_assert(select_isa(sigma::meta::type_c<float>, 4_u) != sigma::meta::type_c<isa::Scalar>
+		|| !is_available(sigma::meta::type_c<isa::SSE>));
+}
+
+template <typename Pack_>
+void pack_arithmetic_test(void)
+{
+	using value_t = typename Pack_::value_t;
+	constexpr std::size_t width = Pack_::width;
+
+	value_t lhs[width], rhs[width], output[width];
+	for (std::size_t lane = 0; lane < width; ++lane)
+	{
+		lhs[lane] = static_cast<value_t>(lane) + 1;
+		rhs[lane] = static_cast<value_t>(width - lane);
+	}
+
+	const Pack_ a = Pack_::load(lhs);
+	const Pack_ b = Pack_::load(rhs);
+
+	fma(a, b, Pack_::broadcast(2)).store(output);
+	for (std::size_t lane = 0; lane < width; ++lane) assert(output[lane] == lhs[lane] * rhs[lane] + 2);
+
+	min(a, b).store(output);
+	for (std::size_t lane = 0; lane < width; ++lane) assert(output[lane] == (lhs[lane] < rhs[lane] ? lhs[lane] : rhs[lane]));
+
+	(-(a - b) / Pack_::broadcast(2)).store(output);
+	for (std::size_t lane = 0; lane < width; ++lane) assert(output[lane] == (rhs[lane] - lhs[lane]) / 2);
+
+	assert(hsum(a) == static_cast<value_t>(width * (width + 1) / 2));
+}
+
+// lane bit operations, comparisons and selection
+template <typename Pack_>
+void pack_bitwise_test(void)
+{
+	using value_t = typename Pack_::value_t;
+	constexpr std::size_t width = Pack_::width;
+	constexpr std::size_t mantissa = std::numeric_limits<value_t>::digits - 1;
+
+	value_t input[width], output[width];
+	for (std::size_t lane = 0; lane < width; ++lane) input[lane] = (lane % 2 ? -1 : 1) * static_cast<value_t>(lane + 1);
+
+	const Pack_ x = Pack_::load(input);
+	const Pack_ sign = Pack_::broadcast(value_t(-0.0));
+
+	//	Test sign manipulation
+
+	andnot(sign, x).store(output);
+	for (std::size_t lane = 0; lane < width; ++lane) assert(output[lane] == static_cast<value_t>(lane + 1));
+
+	(x ^ sign).store(output);
+	for (std::size_t lane = 0; lane < width; ++lane) assert(output[lane] == -input[lane]);
+
+	//	Test shifts move the exponent field, 2 = 1 with the exponent incremented
+
+	shift_right(Pack_::broadcast(2), std::integral_constant<std::size_t, mantissa>{}).store(output);
+	const Pack_ exponent = Pack_::load(output);
+	shift_left(exponent, std::integral_constant<std::size_t, mantissa>{}).store(output);
+	for (std::size_t lane = 0; lane < width; ++lane) assert(output[lane] == 2);
+
+	//	Test comparisons select lanes
+
+	select(less(x, Pack_::zero()), Pack_::zero(), x).store(output);
+	for (std::size_t lane = 0; lane < width; ++lane) assert(output[lane] == (lane % 2 ? 0 : input[lane]));
+
+	select(equal(x, Pack_::broadcast(1)), Pack_::broadcast(7), x & Pack_::broadcast(0)).store(output);
+	for (std::size_t lane = 0; lane < width; ++lane) assert(output[lane] == (lane == 0 ? 7 : 0));
+}
+
+void simd_test_main(void)
+{
+	isa_selection_test();
+
+	pack_arithmetic_test<Pack<float, isa::Scalar>>();
+	pack_arithmetic_test<Pack<int, isa::Scalar>>();
+	pack_bitwise_test<Pack<float, isa::Scalar>>();
+	pack_bitwise_test<Pack<double, isa::Scalar>>();
+#if defined(__SSE2__)
+	pack_arithmetic_test<Pack<float, isa::SSE>>();
+	pack_arithmetic_test<Pack<double, isa::SSE>>();
+	pack_bitwise_test<Pack<float, isa::SSE>>();
+	pack_bitwise_test<Pack<double, isa::SSE>>();
+#endif
+#if defined(__AVX2__)
+	pack_arithmetic_test<Pack<float, isa::AVX2>>();
+	pack_arithmetic_test<Pack<double, isa::AVX2>>();
+	pack_bitwise_test<Pack<float, isa::AVX2>>();
+	pack_bitwise_test<Pack<double, isa::AVX2>>();
+#endif
+#if defined(__AVX512F__)
+	pack_arithmetic_test<Pack<float, isa::AVX512>>();
+	pack_arithmetic_test<Pack<double, isa::AVX512>>();
+	pack_bitwise_test<Pack<float, isa::AVX512>>();
+	pack_bitwise_test<Pack<double, isa::AVX512>>();
+#endif
+}
+
+#endif	//	_SIGMA_API_MATH_TESTING_SIMD_TEST_HPP_
\ No newline at end of file
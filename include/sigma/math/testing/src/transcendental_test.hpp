@@ -0,0 +1,166 @@
+#ifndef		_SIGMA_API_MATH_TESTING_TRANSCENDENTAL_TEST_HPP_
+#define		_SIGMA_API_MATH_TESTING_TRANSCENDENTAL_TEST_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <sigma/math/algorithm/transcendental.hpp>
+#include <sigma/math/container/array.hpp>
+
+using namespace sigma::math;
+
+// polynomial evaluation and fitting, constant evaluation takes the scalar pack
+void polynomial_test(void)
+{
+	using scalar_t = Pack<double, isa::Scalar>;
+	constexpr auto coefficients = sigma::meta::VVector<to_bits(1.0), to_bits(-2.0), to_bits(0.5), to_bits(3.0)>{};
+
+	//	Test both schemes on 1 - 2x + x^2 / 2 + 3x^3
+
+	static_assert(horner(coefficients, scalar_t{ 2.0 }).value == 23.0);
+	static_assert(estrin(coefficients, scalar_t{ 2.0 }).value == 23.0);
+	static_assert(estrin(sigma::meta::VVector<to_bits(4.0)>{}, scalar_t{ 2.0 }).value == 4.0);
+
+	//	Test degrees grow with the tier and coefficients are stored per type
+
+	static_assert(detail::degree_v<detail::ExpKernel, float, accuracy::Low>
+		< detail::degree_v<detail::ExpKernel, float, accuracy::Full>);
+	static_assert(detail::degree_v<detail::ExpKernel, float, accuracy::Full>
+		< detail::degree_v<detail::ExpKernel, double, accuracy::Full>);
+	static_assert(polynomial_v<detail::ExpKernel, double, accuracy::Medium>.size()
+		== detail::degree_v<detail::ExpKernel, double, accuracy::Medium> + 1);
+
+	//	Test the fitted kernels at compile time
+
+	constexpr double e = exp(scalar_t{ 1.0 }).value;
+	static_assert(e - 2.718281828459045 < 1e-15 && 2.718281828459045 - e < 1e-15);
+	static_assert(log(scalar_t{ 1.0 }).value == 0.0);
+	static_assert(cos(scalar_t{ 0.0 }).value == 1.0);
+}
+
+// worst error over an even sampling of [lower, upper] against long double libm,
+// relative unless absolute_ is set
+template <typename Type_, typename Function_, typename Reference_>
+long double transcendental_error(Function_ function, Reference_ reference, long double lower, long double upper,
+	bool absolute_)
+{
+	constexpr std::size_t size = 20011;
+
+	std::vector<Type_> input(size), output(size);
+	for (std::size_t index = 0; index < size; ++index)
+		input[index] = static_cast<Type_>(lower + (upper - lower) * index / (size - 1));
+
+	function(size, input.data(), output.data());
+
+	long double worst = 0;
+	for (std::size_t index = 0; index < size; ++index)
+	{
+		const long double expected = reference(static_cast<long double>(input[index]));
+		long double error = std::fabs(output[index] - expected);
+		if (!absolute_ && expected != 0) error /= std::fabs(expected);
+		if (error > worst) worst = error;
+	}
+	return worst;
+}
+
+// every function against its tier bound, never tighter than 4 ulp
+template <typename Type_, typename Accuracy_>
+void transcendental_accuracy_test(void)
+{
+	const long double bound = std::max(4 * static_cast<long double>(std::numeric_limits<Type_>::epsilon()),
+		tolerance(sigma::meta::type_c<Accuracy_>, sigma::meta::type_c<Type_>));
+	const long double lower = std::numeric_limits<Type_>::min_exponent * 0.69L + 1;
+	const long double upper = std::numeric_limits<Type_>::max_exponent * 0.69L - 1;
+
+	assert(transcendental_error<Type_>([](auto... arguments) { exp<Accuracy_>(arguments...); },
+		[](long double x) { return std::exp(x); }, lower, upper, false) <= bound);
+	assert(transcendental_error<Type_>([](auto... arguments) { log<Accuracy_>(arguments...); },
+		[](long double x) { return std::log(x); }, 1e-3L, 1e3L, false) <= bound);
+	assert(transcendental_error<Type_>([](auto... arguments) { log<Accuracy_>(arguments...); },
+		[](long double x) { return std::log(x); }, 0.5L, 2, false) <= bound);
+	assert(transcendental_error<Type_>([](auto... arguments) { sin<Accuracy_>(arguments...); },
+		[](long double x) { return std::sin(x); }, -2000, 2000, true) <= bound);
+	assert(transcendental_error<Type_>([](auto... arguments) { cos<Accuracy_>(arguments...); },
+		[](long double x) { return std::cos(x); }, -2000, 2000, true) <= bound);
+	assert(transcendental_error<Type_>([](auto... arguments) { erf<Accuracy_>(arguments...); },
+		[](long double x) { return std::erf(x); }, -7, 7, false) <= bound);
+}
+
+// infinities, nans, zeros, subnormals and the remainder lanes
+template <typename Type_>
+void transcendental_special_test(void)
+{
+	using limits_t = std::numeric_limits<Type_>;
+
+	const Type_ input[] = { limits_t::infinity(), -limits_t::infinity(), limits_t::quiet_NaN(), Type_(0), Type_(-1),
+		limits_t::denorm_min(), Type_(1000), Type_(-1000) };
+	constexpr std::size_t size = sizeof(input) / sizeof(Type_);
+	Type_ output[size];
+
+	exp(size, input, output);
+	assert(output[0] == limits_t::infinity() && output[1] == 0 && std::isnan(output[2]));
+	assert(output[3] == 1 && output[6] == limits_t::infinity() && output[7] == 0);
+
+	log(size, input, output);
+	assert(output[0] == limits_t::infinity() && std::isnan(output[1]) && std::isnan(output[2]));
+	assert(output[3] == -limits_t::infinity() && std::isnan(output[4]));
+	assert(std::fabs(output[5] - std::log(static_cast<long double>(limits_t::denorm_min()))) <= 1e-5L);
+
+	sin(size, input, output);
+	assert(std::isnan(output[0]) && std::isnan(output[1]) && std::isnan(output[2]) && output[3] == 0);
+
+	//	Test arguments past the packed reduction mixed with ordinary ones
+
+	Type_ large[16];
+	for (std::size_t index = 0; index < 16; ++index)
+		large[index] = index % 3 == 0 ? Type_(1e7) * Type_(index + 1) : index % 3 == 1 ? -limits_t::max() : Type_(index);
+	Type_ sines[16], cosines[16];
+	sin(16, large, sines);
+	cos(16, large, cosines);
+	for (std::size_t index = 0; index < 16; ++index)
+	{
+		assert(std::fabs(sines[index] - std::sin(large[index])) <= Type_(1e-5));
+		assert(std::fabs(cosines[index] - std::cos(large[index])) <= Type_(1e-5));
+	}
+
+	erf(size, input, output);
+	assert(output[0] == 1 && output[1] == -1 && std::isnan(output[2]) && output[3] == 0 && output[6] == 1);
+}
+
+// transcendentals fuse into array expressions
+void transcendental_expression_test(void)
+{
+	Array<double> x(37);
+	for (std::size_t index = 0; index < x.size(); ++index) x[index] = static_cast<double>(index) / 8 - 2;
+
+	const Array<double> gaussian = exp(-0.5 * x * x);
+	const Array<double> bounded = erf<accuracy::Low>(x) + sin(x) * cos(x);
+
+	for (std::size_t index = 0; index < x.size(); ++index)
+	{
+		assert(std::fabs(gaussian[index] - std::exp(-0.5 * x[index] * x[index])) <= 1e-15);
+		assert(std::fabs(bounded[index] - (std::erf(x[index]) + std::sin(x[index]) * std::cos(x[index]))) <= 1e-4);
+	}
+}
+
+void transcendental_test_main(void)
+{
+	polynomial_test();
+
+	transcendental_accuracy_test<float, accuracy::Low>();
+	transcendental_accuracy_test<float, accuracy::Medium>();
+	transcendental_accuracy_test<float, accuracy::Full>();
+	transcendental_accuracy_test<double, accuracy::Low>();
+	transcendental_accuracy_test<double, accuracy::Medium>();
+	transcendental_accuracy_test<double, accuracy::Full>();
+
+	transcendental_special_test<float>();
+	transcendental_special_test<double>();
+
+	transcendental_expression_test();
+}
+
+#endif	//	_SIGMA_API_MATH_TESTING_TRANSCENDENTAL_TEST_HPP_
\ No newline at end of file
@@ -0,0 +1,227 @@
+#ifndef		_SIGMA_API_META_ALGORITHM_LOOKUP_TABLE_HPP_
+#define		_SIGMA_API_META_ALGORITHM_LOOKUP_TABLE_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include "../container/packed.hpp"
+#include "../container/vector.hpp"
+
+namespace sigma::meta
+{
+	//	Half open domain of integral keys [first_, last_)
+	template <auto first_, auto last_>
+	struct Range
+	{
+		static_assert(std::is_integral_v<decltype(first_)> && std::is_same_v<decltype(first_), decltype(last_)>,
+			"range bounds must be integrals of the same type");
+		static_assert(first_ <= last_, "range must not be reversed");
+
+		using key_t = decltype(first_);
+
+		static constexpr std::size_t size(void) { return static_cast<std::size_t>(last_ - first_); }
+		static constexpr key_t key(std::size_t index) { return static_cast<key_t>(first_ + index); }
+	};
+
+	//	Element types of a table
+	namespace element
+	{
+		struct Natural;		//	the result type of the function
+		struct Compact;		//	the smallest integral holding every result
+	}
+
+	//	Layouts of a table, both start on a cache line
+	namespace layout
+	{
+		struct Packed;		//	elements back to back
+		struct Gather;		//	elements widened to 32 bits and whole cache lines, so
+							//	that gathers of 32 or 64 bit lanes stay in bounds
+	}
+
+	namespace detail
+	{
+		template <typename Domain_>
+		inline constexpr bool is_range_v = false;
+
+		template <auto first_, auto last_>
+		inline constexpr bool is_range_v<Range<first_, last_>> = true;
+
+		template <typename Domain_>
+		struct TableDomain;
+
+		template <auto first_, auto last_>
+		struct TableDomain<Range<first_, last_>> : Range<first_, last_> {};
+
+		template <auto... values_>
+		struct TableDomain<VVector<values_...>>
+		{
+			static_assert(sizeof...(values_) != 0, "table domain requires values");
+
+			using key_t = std::common_type_t<decltype(values_)...>;
+
+			static constexpr key_t keys[] = { static_cast<key_t>(values_)... };
+
+			static constexpr std::size_t size(void) { return sizeof...(values_); }
+			static constexpr key_t key(std::size_t index) { return keys[index]; }
+		};
+
+		//	smallest integral holding [lower, upper], signed if lower is negative
+
+		template <long long lower_, unsigned long long upper_>
+		inline constexpr auto compact_element(void)
+		{
+			if constexpr (lower_ >= 0)
+			{
+				constexpr std::size_t bits = upper_ == 0 ? 1 : 64 - __builtin_clzll(upper_);
+				return type_c<unsigned_for_t<bits>>;
+			}
+			else
+			{
+				constexpr unsigned long long magnitude = ~static_cast<unsigned long long>(lower_) | upper_;
+				constexpr std::size_t bits = magnitude == 0 ? 1 : 65 - __builtin_clzll(magnitude);
+				return type_c<std::make_signed_t<unsigned_for_t<bits>>>;
+			}
+		}
+
+		template <typename Type_>
+		inline constexpr auto gather_element(Type<Type_>)
+		{
+			if constexpr (sizeof(Type_) >= 4 || !std::is_integral_v<Type_>) return type_c<Type_>;
+			else if constexpr (std::is_signed_v<Type_>) return type_c<std::int32_t>;
+			else return type_c<std::uint32_t>;
+		}
+	}
+
+	//	Table of function_ over the keys of Domain_, a Range or a VVector,
+	//	evaluated during compilation into an aligned static constexpr array
+	//	that lives in read only data. Element_ is element::Natural,
+	//	element::Compact or an explicit type every result must convert to
+	//	without loss; Layout_ is layout::Packed or layout::Gather
+
+	template <auto function_, typename Domain_, typename Element_ = element::Natural,
+		typename Layout_ = layout::Packed>
+	class LookupTable
+	{
+		using domain_t = detail::TableDomain<Domain_>;
+
+	public:
+
+		using key_t = typename domain_t::key_t;
+		using result_t = std::decay_t<decltype(function_(domain_t::key(0)))>;
+
+		static constexpr std::size_t alignment = 64;
+
+		static constexpr std::size_t size(void) { return domain_t::size(); }
+
+	private:
+
+		//	The function is evaluated straight into the storage, so that every
+		//	entry costs one call during compilation; compact tables pay one more
+		//	call per entry to find the range of the results and explicitly typed
+		//	tables one more to check the conversion
+
+		struct Bounds
+		{
+			long long lower;
+			unsigned long long upper;
+		};
+
+		static constexpr Bounds result_bounds(void)
+		{
+			Bounds bounds{ 0, 0 };
+			for (std::size_t index = 0; index < size(); ++index)
+			{
+				const result_t result = function_(domain_t::key(index));
+				if (std::is_signed_v<result_t> && result < 0 && static_cast<long long>(result) < bounds.lower)
+					bounds.lower = static_cast<long long>(result);
+				if (result > 0 && static_cast<unsigned long long>(result) > bounds.upper)
+					bounds.upper = static_cast<unsigned long long>(result);
+			}
+			return bounds;
+		}
+
+		static constexpr auto select_element(void)
+		{
+			if constexpr (std::is_same_v<Element_, element::Natural>) return type_c<result_t>;
+			else if constexpr (std::is_same_v<Element_, element::Compact>)
+			{
+				static_assert(std::is_integral_v<result_t>, "compact tables require integral results");
+
+				constexpr auto bounds = result_bounds();
+
+				return detail::compact_element<bounds.lower, bounds.upper>();
+			}
+			else return type_c<Element_>;
+		}
+
+		using stored_t = typename decltype(select_element())::type_t;
+
+	public:
+
+		using element_t = std::conditional_t<std::is_same_v<Layout_, layout::Gather>,
+			typename decltype(detail::gather_element(type_c<stored_t>))::type_t, stored_t>;
+
+		//	elements including the padding of the gather layout, at least one
+		//	so that empty domains still have storage
+		static constexpr std::size_t capacity(void)
+		{
+			constexpr std::size_t line = alignment / sizeof(element_t) == 0 ? 1 : alignment / sizeof(element_t);
+			constexpr std::size_t elements = size() == 0 ? 1 : size();
+			if constexpr (std::is_same_v<Layout_, layout::Gather>) return (elements + line - 1) / line * line;
+			else return elements;
+		}
+
+	private:
+
+		static constexpr bool lossless(void)
+		{
+			if constexpr (!std::is_same_v<Element_, element::Natural> && !std::is_same_v<Element_, element::Compact>)
+				for (std::size_t index = 0; index < size(); ++index)
+				{
+					const result_t result = function_(domain_t::key(index));
+					if (!(static_cast<result_t>(static_cast<element_t>(result)) == result)) return false;
+				}
+			return true;
+		}
+
+		static_assert(lossless(), "table element type cannot represent every result");
+
+		struct alignas(alignment) Storage
+		{
+			element_t values[capacity()];
+		};
+
+		static constexpr Storage make(void)
+		{
+			Storage storage{};
+			for (std::size_t index = 0; index < size(); ++index)
+				storage.values[index] = static_cast<element_t>(function_(domain_t::key(index)));
+			return storage;
+		}
+
+		static constexpr Storage storage_ = make();
+
+	public:
+
+		static constexpr const element_t * data(void) { return storage_.values; }
+
+		static constexpr element_t get(std::size_t index) { return storage_.values[index]; }
+		constexpr element_t operator[] (std::size_t index) const { return get(index); }
+
+		//	by key of a Range domain, unchecked
+		static constexpr element_t at(key_t key)
+		{
+			static_assert(detail::is_range_v<Domain_>, "lookup by key requires a range domain");
+			return storage_.values[static_cast<std::size_t>(key - domain_t::key(0))];
+		}
+
+		static constexpr const element_t * begin(void) { return data(); }
+		static constexpr const element_t * end(void) { return data() + size(); }
+	};
+
+	template <auto function_, typename Domain_, typename Element_ = element::Natural,
+		typename Layout_ = layout::Packed>
+	inline constexpr LookupTable<function_, Domain_, Element_, Layout_> lookup_table{};
+}
+
+#endif	//	_SIGMA_API_META_ALGORITHM_LOOKUP_TABLE_HPP_
\ No newline at end of file
@@ -0,0 +1,274 @@
+#ifndef		_SIGMA_API_META_ALGORITHM_SORTING_NETWORK_HPP_
+#define		_SIGMA_API_META_ALGORITHM_SORTING_NETWORK_HPP_
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include "../container/vector.hpp"
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+namespace sigma::meta
+{
+	//	A sorting network is a VVector of comparator index pairs laid out flat:
+	//		VVector<lhs0, rhs0, lhs1, rhs1, ...>
+	//	each comparator leaves the smaller value at lhs and the larger at rhs
+
+	namespace detail
+	{
+		//	Batcher's odd-even merge sort, generalised to any size
+		//	(Knuth, TAOCP vol. 3, 5.2.2 - algorithm M)
+
+		template <typename Visitor_>
+		constexpr void batcher_visit(std::size_t size, Visitor_ && visit)
+		{
+			for (std::size_t p = 1; p < size; p *= 2)
+				for (std::size_t k = p; k >= 1; k /= 2)
+					for (std::size_t j = k % p; j + k < size; j += 2 * k)
+						for (std::size_t i = 0; i < k && i + j + k < size; ++i)
+							if ((i + j) / (2 * p) == (i + j + k) / (2 * p))
+								visit(i + j, i + j + k);
+		}
+
+		template <std::size_t size_>
+		constexpr std::size_t batcher_count(void)
+		{
+			std::size_t count = 0;
+			batcher_visit(size_, [&count](std::size_t, std::size_t) { ++count; });
+			return count;
+		}
+
+		template <std::size_t size_>
+		constexpr auto batcher_pairs(void)
+		{
+			std::array<std::size_t, 2 * batcher_count<size_>()> pairs{};
+			std::size_t index = 0;
+			batcher_visit(size_, [&pairs, &index](std::size_t lhs, std::size_t rhs)
+			{
+				pairs[index++] = lhs;
+				pairs[index++] = rhs;
+			});
+			return pairs;
+		}
+
+		template <std::size_t size_, std::size_t... indices_>
+		constexpr auto make_network(std::index_sequence<indices_...>)
+		{
+			constexpr auto pairs = batcher_pairs<size_>();
+			return VVector<pairs[indices_]...>{};
+		}
+
+		template <std::size_t size_, auto... pairs_>
+		constexpr void assert_network(void)
+		{
+			static_assert(sizeof...(pairs_) % 2 == 0,
+				"sorting network requires comparator index pairs");
+			static_assert(((static_cast<std::size_t>(pairs_) < size_) && ...),
+				"sorting network comparator is out of bounds");
+		}
+
+		//	branchless: both selects lower to cmov / min / max
+
+		template <std::size_t lhs_, std::size_t rhs_, typename Type_>
+		inline void compare_exchange(Type_ * data)
+		{
+			const Type_ lhs = data[lhs_];
+			const Type_ rhs = data[rhs_];
+			data[lhs_] = rhs < lhs ? rhs : lhs;
+			data[rhs_] = rhs < lhs ? lhs : rhs;
+		}
+
+		//	one comparator applied to every column of a row-major [size x lanes_] block.
+		//	Rows of arithmetic types are exchanged one register of the target at a
+		//	time with packed min and max; other types and rows not a multiple of
+		//	the register take the plain loop
+
+#if defined(__AVX512F__)
+#define		SIGMA_META_LANE_INTRINSIC(name_)	_mm512_##name_
+		inline constexpr std::size_t lane_register_size = 64;
+#elif defined(__AVX__)
+#define		SIGMA_META_LANE_INTRINSIC(name_)	_mm256_##name_
+		inline constexpr std::size_t lane_register_size = 32;
+#elif defined(__SSE2__)
+#define		SIGMA_META_LANE_INTRINSIC(name_)	_mm_##name_
+		inline constexpr std::size_t lane_register_size = 16;
+#else
+		inline constexpr std::size_t lane_register_size = 16;
+#endif
+
+		template <typename Type_, std::size_t lanes_>
+		inline constexpr bool is_packed_lanes = std::is_arithmetic_v<Type_> && !std::is_same_v<Type_, bool>
+			&& lane_register_size % sizeof(Type_) == 0 && (lanes_ * sizeof(Type_)) % lane_register_size == 0;
+
+		//	the attribute only applies to a declaration, hence the typedef
+		template <typename Type_>
+		struct LaneRegister { typedef Type_ type __attribute__((vector_size(lane_register_size))); };
+
+		//	compare_exchange over one register of each row. Vector selects on
+		//	floating point compile to compares and blends, so float and double
+		//	use the min / max instructions, whose operand order keeps the
+		//	results of the scalar selects for equal values and nans
+
+		template <typename Type_>
+		inline void compare_exchange_register(Type_ * lhs_row, Type_ * rhs_row)
+		{
+#if defined(SIGMA_META_LANE_INTRINSIC)
+			if constexpr (std::is_same_v<Type_, float>)
+			{
+				const auto lhs = SIGMA_META_LANE_INTRINSIC(loadu_ps)(lhs_row);
+				const auto rhs = SIGMA_META_LANE_INTRINSIC(loadu_ps)(rhs_row);
+				SIGMA_META_LANE_INTRINSIC(storeu_ps)(lhs_row, SIGMA_META_LANE_INTRINSIC(min_ps)(rhs, lhs));
+				SIGMA_META_LANE_INTRINSIC(storeu_ps)(rhs_row, SIGMA_META_LANE_INTRINSIC(max_ps)(lhs, rhs));
+			}
+			else if constexpr (std::is_same_v<Type_, double>)
+			{
+				const auto lhs = SIGMA_META_LANE_INTRINSIC(loadu_pd)(lhs_row);
+				const auto rhs = SIGMA_META_LANE_INTRINSIC(loadu_pd)(rhs_row);
+				SIGMA_META_LANE_INTRINSIC(storeu_pd)(lhs_row, SIGMA_META_LANE_INTRINSIC(min_pd)(rhs, lhs));
+				SIGMA_META_LANE_INTRINSIC(storeu_pd)(rhs_row, SIGMA_META_LANE_INTRINSIC(max_pd)(lhs, rhs));
+			}
+			else
+#endif
+			{
+				using register_t = typename LaneRegister<Type_>::type;
+
+				register_t lhs, rhs;
+				std::memcpy(&lhs, lhs_row, sizeof(register_t));
+				std::memcpy(&rhs, rhs_row, sizeof(register_t));
+
+				const register_t lower = rhs < lhs ? rhs : lhs;
+				const register_t upper = rhs < lhs ? lhs : rhs;
+				std::memcpy(lhs_row, &lower, sizeof(register_t));
+				std::memcpy(rhs_row, &upper, sizeof(register_t));
+			}
+		}
+
+#undef		SIGMA_META_LANE_INTRINSIC
+
+		template <std::size_t lhs_, std::size_t rhs_, std::size_t lanes_, typename Type_>
+		inline void compare_exchange_lanes(Type_ * data)
+		{
+			Type_ * lhs_row = data + lhs_ * lanes_;
+			Type_ * rhs_row = data + rhs_ * lanes_;
+
+			if constexpr (is_packed_lanes<Type_, lanes_>)
+				for (std::size_t lane = 0; lane < lanes_; lane += lane_register_size / sizeof(Type_))
+					compare_exchange_register(lhs_row + lane, rhs_row + lane);
+			else
+				for (std::size_t lane = 0; lane < lanes_; ++lane)
+				{
+					const Type_ lhs = lhs_row[lane];
+					const Type_ rhs = rhs_row[lane];
+					lhs_row[lane] = rhs < lhs ? rhs : lhs;
+					rhs_row[lane] = rhs < lhs ? lhs : rhs;
+				}
+		}
+
+		template <auto... pairs_, typename Type_, std::size_t... indices_>
+		inline void apply_network(Type_ * data, std::index_sequence<indices_...>)
+		{
+			constexpr std::size_t pairs[] = { static_cast<std::size_t>(pairs_)..., 0 };
+			(compare_exchange<pairs[2 * indices_], pairs[2 * indices_ + 1]>(data), ...);
+		}
+
+		template <std::size_t lanes_, auto... pairs_, typename Type_, std::size_t... indices_>
+		inline void apply_network_lanes(Type_ * data, std::index_sequence<indices_...>)
+		{
+			constexpr std::size_t pairs[] = { static_cast<std::size_t>(pairs_)..., 0 };
+			(compare_exchange_lanes<pairs[2 * indices_], pairs[2 * indices_ + 1], lanes_>(data), ...);
+		}
+	}
+
+	//		**	GENERATION **
+
+	template <std::size_t size_>
+	inline constexpr auto sorting_network(std::integral_constant<std::size_t, size_>)
+	{
+		return detail::make_network<size_>(
+			std::make_index_sequence<2 * detail::batcher_count<size_>()>{});
+	}
+
+	template <std::size_t size_>
+	inline constexpr auto sorting_network(void)
+	{ return sorting_network(std::integral_constant<std::size_t, size_>{}); }
+
+	//		**	VALIDATION **
+
+	//	zero-one principle: a network sorts every input iff it sorts every binary input,
+	//	exhaustive so only intended for small sizes in static_asserts, the default
+	//	constexpr operation limit is reached at around 12 elements
+
+	template <std::size_t size_, auto... pairs_>
+	inline constexpr bool is_sorting_network(VVector<pairs_...>)
+	{
+		static_assert(size_ < 32, "exhaustive validation is limited to 31 elements");
+		detail::assert_network<size_, pairs_...>();
+
+		constexpr std::size_t pairs[] = { static_cast<std::size_t>(pairs_)..., 0 };
+
+		for (std::uint32_t input = 0; input < (std::uint32_t{ 1 } << size_); ++input)
+		{
+			std::uint32_t bits = input;
+			for (std::size_t index = 0; index + 1 < sizeof(pairs) / sizeof(*pairs); index += 2)
+			{
+				const std::uint32_t lhs = (bits >> pairs[index]) & 1;
+				const std::uint32_t rhs = (bits >> pairs[index + 1]) & 1;
+				if (lhs > rhs) bits ^= (std::uint32_t{ 1 } << pairs[index]) | (std::uint32_t{ 1 } << pairs[index + 1]);
+			}
+
+			//	sorted binary input has all of its ones in the highest positions
+			std::size_t zeros = size_;
+			for (std::uint32_t rest = bits; rest != 0; rest &= rest - 1) --zeros;
+
+			const std::uint32_t mask = (std::uint32_t{ 1 } << size_) - 1;
+			if (bits != (mask & ~((std::uint32_t{ 1 } << zeros) - 1))) return false;
+		}
+
+		return true;
+	}
+
+	//		**	SORTING **
+
+	template <std::size_t size_, auto... pairs_, typename Type_>
+	inline void network_sort(VVector<pairs_...>, Type_ * data)
+	{
+		detail::assert_network<size_, pairs_...>();
+		detail::apply_network<pairs_...>(data, std::make_index_sequence<sizeof...(pairs_) / 2>{});
+	}
+
+	template <auto... pairs_, typename Type_, std::size_t size_>
+	inline void network_sort(VVector<pairs_...> network, Type_ (&data)[size_])
+	{ network_sort<size_>(network, data); }
+
+	template <auto... pairs_, typename Type_, std::size_t size_>
+	inline void network_sort(VVector<pairs_...> network, std::array<Type_, size_> & data)
+	{ network_sort<size_>(network, data.data()); }
+
+	template <typename Type_, std::size_t size_>
+	inline void network_sort(Type_ (&data)[size_])
+	{ network_sort(sorting_network<size_>(), data); }
+
+	template <typename Type_, std::size_t size_>
+	inline void network_sort(std::array<Type_, size_> & data)
+	{ network_sort(sorting_network<size_>(), data); }
+
+	//	sorts lanes_ independent arrays at once, stored column-wise in a
+	//	row-major [size_ x lanes_] block - every comparator becomes a packed min / max
+
+	template <std::size_t size_, std::size_t lanes_, auto... pairs_, typename Type_>
+	inline void network_sort_lanes(VVector<pairs_...>, Type_ * data)
+	{
+		detail::assert_network<size_, pairs_...>();
+		detail::apply_network_lanes<lanes_, pairs_...>(data, std::make_index_sequence<sizeof...(pairs_) / 2>{});
+	}
+
+	template <std::size_t size_, std::size_t lanes_, typename Type_>
+	inline void network_sort_lanes(Type_ * data)
+	{ network_sort_lanes<size_, lanes_>(sorting_network<size_>(), data); }
+}
+
+#endif	//	_SIGMA_API_META_ALGORITHM_SORTING_NETWORK_HPP_
\ No newline at end of file
@@ -0,0 +1,219 @@
+#ifndef		_SIGMA_API_META_ALGORITHM_STATE_MACHINE_HPP_
+#define		_SIGMA_API_META_ALGORITHM_STATE_MACHINE_HPP_
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "../container/type_map.hpp"
+#include "../container/vector.hpp"
+
+namespace sigma::meta
+{
+	//	Action of transitions without one
+	struct NoAction
+	{
+		template <typename... Args_>
+		constexpr void operator () (Args_ &&...) const {}
+	};
+
+	//	Context of machines without one
+	struct NoContext {};
+
+	//	Element of the transition vector of a StateMachine. Action_ is default
+	//	constructed and called with (context, event), (context) or () on firing
+
+	template <typename From_, typename Event_, typename To_, typename Action_ = NoAction>
+	struct Transition
+	{
+		using from_t = From_;
+		using event_t = Event_;
+		using to_t = To_;
+		using action_t = Action_;
+	};
+
+	namespace detail
+	{
+		//	the validations work on parallel arrays of state and event ids,
+		//	one entry per transition
+
+		template <std::size_t size_>
+		inline constexpr bool is_deterministic(const std::size_t (&froms)[size_], const std::size_t (&events)[size_],
+			std::size_t count)
+		{
+			for (std::size_t lhs = 0; lhs < count; ++lhs)
+				for (std::size_t rhs = lhs + 1; rhs < count; ++rhs)
+					if (froms[lhs] == froms[rhs] && events[lhs] == events[rhs]) return false;
+			return true;
+		}
+
+		//	every state reached from state 0 by following transitions
+		template <std::size_t state_count_, std::size_t size_>
+		inline constexpr bool is_reachable(const std::size_t (&froms)[size_], const std::size_t (&tos)[size_],
+			std::size_t count)
+		{
+			bool reached[state_count_] = { true };
+
+			for (bool grown = true; grown;)
+			{
+				grown = false;
+				for (std::size_t index = 0; index < count; ++index)
+					if (reached[froms[index]] && !reached[tos[index]]) grown = reached[tos[index]] = true;
+			}
+
+			for (bool state : reached)
+				if (!state) return false;
+			return true;
+		}
+
+		template <typename Action_, typename Context_, typename Event_>
+		inline void fire_action(Context_ & context, const Event_ & event)
+		{
+			Action_ action{};
+			if constexpr (std::is_invocable_v<Action_ &, Context_ &, const Event_ &>) action(context, event);
+			else if constexpr (std::is_invocable_v<Action_ &, Context_ &>) action(context);
+			else
+			{
+				static_assert(std::is_invocable_v<Action_ &>,
+					"transition action must be callable with (context, event), (context) or ()");
+				action();
+			}
+		}
+	}
+
+	template <typename States_, typename Events_, typename Transitions_, typename Context_ = NoContext>
+	class StateMachine;
+
+	//	Finite state machine checked and tabulated at compile time. States and
+	//	events are types, the first state is the initial one. Transitions must
+	//	be deterministic and reach every state. Processing an event is a load
+	//	from a flat state x event table of handlers and a call of the handler,
+	//	which runs the action and returns the next state; pairs without a
+	//	transition leave the state unchanged
+
+	template <typename... States_, typename... Events_, typename... Transitions_, typename Context_>
+	class StateMachine<TVector<States_...>, TVector<Events_...>, TVector<Transitions_...>, Context_>
+	{
+		using states_t = TVector<States_...>;
+		using events_t = TVector<Events_...>;
+		using transitions_t = TVector<Transitions_...>;
+		using context_t = std::remove_reference_t<Context_>;
+
+	public:
+
+		static constexpr std::size_t state_count = sizeof...(States_);
+		static constexpr std::size_t event_count = sizeof...(Events_);
+		static constexpr std::size_t transition_count = sizeof...(Transitions_);
+
+		template <typename State_>
+		static constexpr std::size_t state_id(Type<State_> state) { return type_id(states_t{}, state); }
+
+		template <typename Event_>
+		static constexpr std::size_t event_id(Type<Event_> event) { return type_id(events_t{}, event); }
+
+	private:
+
+		static_assert(state_count != 0, "state machine requires states");
+		static_assert(event_count != 0, "state machine requires events");
+		static_assert(!detail::has_duplicate_types<States_...>(), "state machine states must be unique");
+		static_assert(!detail::has_duplicate_types<Events_...>(), "state machine events must be unique");
+
+		//	one trailing entry so that machines without transitions compile
+		static constexpr std::size_t froms_[] = { state_id(type_c<typename Transitions_::from_t>)..., 0 };
+		static constexpr std::size_t events_[] = { event_id(type_c<typename Transitions_::event_t>)..., 0 };
+		static constexpr std::size_t tos_[] = { state_id(type_c<typename Transitions_::to_t>)..., 0 };
+
+		static_assert(detail::is_deterministic(froms_, events_, transition_count),
+			"state machine has two transitions on the same state and event");
+		static_assert(detail::is_reachable<state_count>(froms_, tos_, transition_count),
+			"state machine has states unreachable from the initial state");
+
+		using handler_t = std::size_t (*)(context_t &, const void *);
+
+		template <std::size_t transition_>
+		static std::size_t fire(context_t & context, const void * event)
+		{
+			using transition_t = typename decltype(transitions_t::get(
+				std::integral_constant<std::size_t, transition_>{}))::type_t;
+			using event_t = typename transition_t::event_t;
+
+			detail::fire_action<typename transition_t::action_t>(context, *static_cast<const event_t *>(event));
+			return tos_[transition_];
+		}
+
+		template <std::size_t state_>
+		static std::size_t ignore(context_t &, const void *) { return state_; }
+
+		//	transition_count when the pair has no transition
+		static constexpr std::size_t transition_of(std::size_t state, std::size_t event)
+		{
+			std::size_t index = 0;
+			while (index < transition_count && (froms_[index] != state || events_[index] != event)) ++index;
+			return index;
+		}
+
+		template <std::size_t slot_>
+		static constexpr handler_t handler(void)
+		{
+			constexpr std::size_t transition = transition_of(slot_ / event_count, slot_ % event_count);
+			if constexpr (transition == transition_count) return &ignore<slot_ / event_count>;
+			else return &fire<transition>;
+		}
+
+		template <std::size_t... slots_>
+		static constexpr std::array<handler_t, sizeof...(slots_)> make_table(std::index_sequence<slots_...>)
+		{ return { { handler<slots_>()... } }; }
+
+		static constexpr std::array<handler_t, state_count * event_count> table_ =
+			make_table(std::make_index_sequence<state_count * event_count>{});
+
+		std::size_t state_ = 0;
+		Context_ context_;
+
+	public:
+
+		StateMachine(void) = default;
+		explicit StateMachine(Context_ context) : context_(std::forward<Context_>(context)) {}
+
+		//	whether event changes state or runs an action in state
+		static constexpr bool accepts(std::size_t state, std::size_t event)
+		{ return transition_of(state, event) != transition_count; }
+
+		std::size_t state(void) const { return state_; }
+
+		template <typename State_>
+		bool is(Type<State_> state) const { return state_ == state_id(state); }
+
+		template <typename State_>
+		bool is(void) const { return is(type_c<State_>); }
+
+		context_t & context(void) { return context_; }
+		const context_t & context(void) const { return context_; }
+
+		void reset(void) { state_ = 0; }
+
+		template <typename Event_>
+		void process(const Event_ & event)
+		{
+			constexpr std::size_t id = event_id(type_c<Event_>);
+			state_ = table_[state_ * event_count + id](context_, &event);
+		}
+
+		//	event chosen at run time, default constructed, for decoded messages
+		//	whose events carry no payload; false and the state unchanged for
+		//	ids past the events
+		bool process_id(std::size_t event)
+		{
+			static const std::tuple<Events_...> instances{};
+			static const void * const pointers[] = { &std::get<Events_>(instances)... };
+
+			if (event >= event_count) return false;
+
+			state_ = table_[state_ * event_count + event](context_, pointers[event]);
+			return true;
+		}
+	};
+}
+
+#endif	//	_SIGMA_API_META_ALGORITHM_STATE_MACHINE_HPP_
\ No newline at end of file
@@ -0,0 +1,385 @@
+#ifndef		_SIGMA_API_META_ALGORITHM_STRING_SWITCH_HPP_
+#define		_SIGMA_API_META_ALGORITHM_STRING_SWITCH_HPP_
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include "../container/string.hpp"
+#include "../container/vector.hpp"
+
+namespace sigma::meta
+{
+	namespace detail
+	{
+		//	Small key sets are first tried with a direct hash: (features * seed)
+		//	>> (32 - bits), a multiplicative hash into a table of 2^bits slots.
+		//	The cheap features are the length and the first, middle and last
+		//	characters; only when no seed separates the keys on those are all
+		//	characters folded in with FNV-1a. A lookup is one hash and one load.
+		//
+		//	Larger key sets, and small ones no seed separates, hash and displace
+		//	(Belazzougui, Botelho and Dietzfelbinger, "Hash, displace, and
+		//	compress"): the FNV-1a hash picks a bucket of about two keys, and a
+		//	displacement searched per bucket, largest buckets first, is mixed into
+		//	the hash to pick a slot of a table at most half full. A lookup is one
+		//	hash and two loads, and the search succeeds for any set of distinct
+		//	keys whose FNV-1a hashes differ
+
+		struct HashPlan
+		{
+			bool full;
+			std::uint32_t seed;
+			std::uint32_t bits;
+		};
+
+		//	key sets the direct hash is tried for
+		inline constexpr std::size_t max_direct_keys = 64;
+
+		//	direct tables never grow past 2^max_hash_bits slots
+		inline constexpr std::uint32_t max_hash_bits = 12;
+
+		//	key sets hash and displace is built for
+		inline constexpr std::size_t max_keys = 4096;
+
+		inline constexpr std::uint32_t cheap_features(std::string_view key)
+		{
+			if (key.empty()) return 0;
+			return static_cast<std::uint32_t>(key.size())
+				^ (static_cast<std::uint32_t>(static_cast<unsigned char>(key.front())) << 8)
+				^ (static_cast<std::uint32_t>(static_cast<unsigned char>(key[key.size() / 2])) << 16)
+				^ (static_cast<std::uint32_t>(static_cast<unsigned char>(key.back())) << 24);
+		}
+
+		inline constexpr std::uint32_t full_features(std::string_view key)
+		{
+			std::uint32_t hash = 2166136261u;
+			for (char c : key) hash = (hash ^ static_cast<unsigned char>(c)) * 16777619u;
+			return hash ^ static_cast<std::uint32_t>(key.size());
+		}
+
+		inline constexpr std::uint32_t slot_of(std::string_view key, const HashPlan & plan)
+		{
+			const std::uint32_t features = plan.full ? full_features(key) : cheap_features(key);
+			return static_cast<std::uint32_t>(features * plan.seed) >> (32 - plan.bits);
+		}
+
+		inline constexpr std::uint32_t ceil_log2(std::size_t value)
+		{
+			std::uint32_t bits = 0;
+			while ((std::size_t{ 1 } << bits) < value) ++bits;
+			return bits;
+		}
+
+		template <std::size_t size_>
+		constexpr bool is_perfect(const std::string_view (&keys)[size_], const HashPlan & plan)
+		{
+			std::uint64_t used[(std::size_t{ 1 } << max_hash_bits) / 64] = {};
+			for (const auto & key : keys)
+			{
+				const std::uint32_t slot = slot_of(key, plan);
+				const std::uint64_t bit = std::uint64_t{ 1 } << (slot % 64);
+				if (used[slot / 64] & bit) return false;
+				used[slot / 64] |= bit;
+			}
+			return true;
+		}
+
+		//	tries table sizes from the smallest power of two holding every key
+		//	up to 8x that, cheap features before full hashing; returns bits == 0
+		//	when no direct hash was found or the keys are too many to try
+
+		template <std::size_t size_>
+		constexpr HashPlan plan_hash(const std::string_view (&keys)[size_])
+		{
+			if (size_ > max_direct_keys) return HashPlan{ false, 0, 0 };
+
+			const std::uint32_t min_bits = ceil_log2(size_) == 0 ? 1 : ceil_log2(size_);
+
+			for (bool full : { false, true })
+				for (std::uint32_t bits = min_bits; bits <= min_bits + 3 && bits <= max_hash_bits; ++bits)
+				{
+					std::uint32_t state = 0x9e3779b9u;
+					for (int attempt = 0; attempt < 256; ++attempt)
+					{
+						state = state * 1664525u + 1013904223u;
+						const HashPlan plan{ full, state | 1u, bits };
+						if (is_perfect(keys, plan)) return plan;
+					}
+				}
+
+			return HashPlan{ false, 0, 0 };
+		}
+
+		template <std::size_t size_>
+		using slot_index_t = std::conditional_t<(size_ < 0xff), std::uint8_t, std::uint16_t>;
+
+		template <std::size_t slot_count_, std::size_t size_>
+		constexpr auto make_slots(const std::string_view (&keys)[size_], const HashPlan & plan)
+		{
+			std::array<slot_index_t<size_>, slot_count_> slots{};
+			for (auto & slot : slots) slot = static_cast<slot_index_t<size_>>(size_);
+			for (std::size_t index = 0; index < size_; ++index)
+				slots[slot_of(keys[index], plan)] = static_cast<slot_index_t<size_>>(index);
+			return slots;
+		}
+
+		//	murmur3 finaliser, so that displacements change every bit of the slot
+		inline constexpr std::uint32_t mix(std::uint32_t hash)
+		{
+			hash = (hash ^ (hash >> 16)) * 0x85ebca6bu;
+			hash = (hash ^ (hash >> 13)) * 0xc2b2ae35u;
+			return hash ^ (hash >> 16);
+		}
+
+		//	Hash and displace table, about two keys per bucket and at least
+		//	two slots per key. found is false when some bucket could not be
+		//	placed, in practice only when two keys have the same hash;
+		//	duplicate tells whether those keys are equal
+
+		template <std::size_t size_>
+		struct DisplacedTable
+		{
+			static constexpr std::uint32_t bucket_bits = ceil_log2(size_) > 1 ? ceil_log2(size_) - 1 : 1;
+			static constexpr std::uint32_t slot_bits = ceil_log2(size_) + 1;
+
+			static constexpr std::uint32_t bucket_of(std::uint32_t hash) { return (hash * 0x9e3779b1u) >> (32 - bucket_bits); }
+
+			static constexpr std::uint32_t slot_of(std::uint32_t hash, std::uint32_t displacement)
+			{ return mix(hash + displacement) >> (32 - slot_bits); }
+
+			bool found;
+			bool duplicate;
+			std::array<std::uint32_t, std::size_t{ 1 } << bucket_bits> displacements;
+			std::array<slot_index_t<size_>, std::size_t{ 1 } << slot_bits> slots;
+		};
+
+		template <std::size_t size_>
+		constexpr DisplacedTable<size_> plan_displaced(const std::string_view (&keys)[size_])
+		{
+			using table_t = DisplacedTable<size_>;
+			using index_t = slot_index_t<size_>;
+
+			constexpr std::size_t bucket_count = std::size_t{ 1 } << table_t::bucket_bits;
+			constexpr index_t empty = static_cast<index_t>(size_);
+
+			table_t table{ false, false, {}, {} };
+			for (auto & slot : table.slots) slot = empty;
+
+			//	keys grouped by bucket with a counting sort
+
+			std::uint32_t hashes[size_] = {};
+			std::size_t starts[bucket_count + 1] = {};
+			for (std::size_t index = 0; index < size_; ++index)
+			{
+				hashes[index] = full_features(keys[index]);
+				++starts[table_t::bucket_of(hashes[index]) + 1];
+			}
+
+			std::size_t largest = 0;
+			for (std::size_t bucket = 0; bucket < bucket_count; ++bucket)
+			{
+				largest = starts[bucket + 1] > largest ? starts[bucket + 1] : largest;
+				starts[bucket + 1] += starts[bucket];
+			}
+
+			std::size_t members[size_] = {};
+			std::size_t filled[bucket_count] = {};
+			for (std::size_t index = 0; index < size_; ++index)
+			{
+				const std::uint32_t bucket = table_t::bucket_of(hashes[index]);
+				members[starts[bucket] + filled[bucket]++] = index;
+			}
+
+			//	every key of a bucket is placed, or the tentative slots are
+			//	released and the next displacement tried
+
+			for (std::size_t count = largest; count != 0; --count)
+				for (std::size_t bucket = 0; bucket < bucket_count; ++bucket)
+				{
+					if (starts[bucket + 1] - starts[bucket] != count) continue;
+
+					const std::size_t * first = members + starts[bucket];
+
+					//	keys of the same hash share every slot, so no displacement
+					//	can separate them
+					for (std::size_t lhs = 0; lhs < count; ++lhs)
+						for (std::size_t rhs = lhs + 1; rhs < count; ++rhs)
+							if (hashes[first[lhs]] == hashes[first[rhs]])
+							{
+								table.duplicate = keys[first[lhs]] == keys[first[rhs]];
+								return table;
+							}
+
+					bool placed = false;
+					for (std::uint32_t attempt = 0; attempt < (1u << 16) && !placed; ++attempt)
+					{
+						const std::uint32_t displacement = attempt * 0x9e3779b9u;
+
+						std::size_t member = 0;
+						while (member < count && table.slots[table_t::slot_of(hashes[first[member]], displacement)] == empty)
+						{
+							table.slots[table_t::slot_of(hashes[first[member]], displacement)] = static_cast<index_t>(first[member]);
+							++member;
+						}
+
+						placed = member == count;
+						if (placed) table.displacements[bucket] = displacement;
+						else
+							while (member != 0)
+							{
+								--member;
+								table.slots[table_t::slot_of(hashes[first[member]], displacement)] = empty;
+							}
+					}
+
+					if (!placed) return table;
+				}
+
+			table.found = true;
+			return table;
+		}
+
+		//	slots of the direct hash when one was found, the hash and displace
+		//	table otherwise; a failed search leaves the latter unfound, so that
+		//	the static_assert on it is the only error
+
+		template <bool direct_, std::uint32_t bits_, std::size_t size_>
+		constexpr auto make_table(const std::string_view (&keys)[size_], const HashPlan & plan)
+		{
+			if constexpr (direct_) return make_slots<std::size_t{ 1 } << bits_>(keys, plan);
+			else return plan_displaced(keys);
+		}
+	}
+
+	//	Compile time string -> index table backed by a generated perfect hash,
+	//	a lookup is one hash, one or two table loads and one key comparison
+
+	template <typename... Strings_>
+	class StringSwitch
+	{
+		static_assert(sizeof...(Strings_) != 0, "string switch requires keys");
+		static_assert(sizeof...(Strings_) <= detail::max_keys, "string switch supports up to 4096 keys");
+
+		static constexpr std::string_view keys_[] = { Strings_::view()... };
+
+		static constexpr detail::HashPlan plan_ = detail::plan_hash(keys_);
+		static constexpr bool direct_ = plan_.bits != 0;
+
+		static constexpr auto table_ = detail::make_table<direct_, plan_.bits>(keys_, plan_);
+
+		static constexpr bool found(void)
+		{
+			if constexpr (direct_) return true;
+			else return table_.found;
+		}
+
+		static constexpr bool duplicate(void)
+		{
+			if constexpr (direct_) return false;
+			else return table_.duplicate;
+		}
+
+		static_assert(!duplicate(), "string switch keys must be unique");
+		static_assert(duplicate() || found(), "no perfect hash found for the string switch keys");
+
+		static constexpr std::size_t slot_of(std::string_view key)
+		{
+			if constexpr (direct_) return detail::slot_of(key, plan_);
+			else
+			{
+				using table_t = std::decay_t<decltype(table_)>;
+				const std::uint32_t hash = detail::full_features(key);
+				return table_t::slot_of(hash, table_.displacements[table_t::bucket_of(hash)]);
+			}
+		}
+
+		static constexpr std::size_t slot(std::string_view key)
+		{
+			if constexpr (direct_) return table_[slot_of(key)];
+			else return table_.slots[slot_of(key)];
+		}
+
+	public:
+
+		static constexpr std::size_t size(void) { return sizeof...(Strings_); }
+
+		//	index returned for keys outside of the table
+		static constexpr std::size_t npos = sizeof...(Strings_);
+
+		static constexpr std::string_view key(std::size_t index) { return keys_[index]; }
+
+		static constexpr std::size_t find(std::string_view key)
+		{
+			const std::size_t index = slot(key);
+			return index != npos && keys_[index] == key ? index : npos;
+		}
+
+		static constexpr bool contains(std::string_view key) { return find(key) != npos; }
+
+		template <typename... Others_>
+		constexpr bool operator == (StringSwitch<Others_...>) const { return false; }
+		constexpr bool operator == (StringSwitch<Strings_...>) const { return true; }
+
+		template <typename... Others_>
+		constexpr bool operator != (StringSwitch<Others_...> other) const { return !(*this == other); }
+	};
+
+	template <typename... Strings_>
+	inline constexpr auto string_switch(Strings_...) { return StringSwitch<Strings_...>{}; }
+
+	template <typename... Strings_>
+	inline constexpr auto string_switch(TVector<Strings_...>) { return StringSwitch<Strings_...>{}; }
+
+	//	Binds one handler per key plus a fallback for misses. Dispatch indexes
+	//	a table of function pointers with the switch result, the fallback sits
+	//	at npos so no branch is taken on the index
+
+	template <typename Switch_, typename Fallback_, typename... Handlers_>
+	class StringDispatch
+	{
+		static_assert(Switch_::size() == sizeof...(Handlers_),
+			"string dispatch requires one handler per key");
+
+		std::tuple<Handlers_..., Fallback_> handlers_;
+
+		template <std::size_t index_, typename Result_, typename... Args_>
+		static Result_ thunk(StringDispatch & self, Args_ &&... args)
+		{ return std::get<index_>(self.handlers_)(std::forward<Args_>(args)...); }
+
+		template <typename... Args_, std::size_t... indices_>
+		decltype(auto) call(std::size_t index, std::index_sequence<indices_...>, Args_ &&... args)
+		{
+			using result_t = std::common_type_t<
+				std::invoke_result_t<std::tuple_element_t<indices_, decltype(handlers_)> &, Args_ &&...>...>;
+			using thunk_t = result_t (*)(StringDispatch &, Args_ &&...);
+
+			static constexpr thunk_t thunks[] = { &thunk<indices_, result_t, Args_...>... };
+			return thunks[index](*this, std::forward<Args_>(args)...);
+		}
+
+	public:
+
+		constexpr StringDispatch(Fallback_ fallback, Handlers_... handlers)
+			: handlers_(std::move(handlers)..., std::move(fallback))
+		{}
+
+		template <typename... Args_>
+		decltype(auto) operator () (std::string_view key, Args_ &&... args)
+		{
+			return call(Switch_::find(key), std::make_index_sequence<sizeof...(Handlers_) + 1>{},
+				std::forward<Args_>(args)...);
+		}
+	};
+
+	template <typename... Strings_, typename Fallback_, typename... Handlers_>
+	inline constexpr auto make_dispatch(StringSwitch<Strings_...>, Fallback_ fallback, Handlers_... handlers)
+	{
+		return StringDispatch<StringSwitch<Strings_...>, Fallback_, Handlers_...>(
+			std::move(fallback), std::move(handlers)...);
+	}
+}
+
+#endif	//	_SIGMA_API_META_ALGORITHM_STRING_SWITCH_HPP_
\ No newline at end of file
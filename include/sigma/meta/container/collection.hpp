@@ -0,0 +1,247 @@
+#ifndef		_SIGMA_API_META_CONTAINER_COLLECTION_HPP_
+#define		_SIGMA_API_META_CONTAINER_COLLECTION_HPP_
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "type_map.hpp"
+
+namespace sigma::meta
+{
+	//	Names an object of a Collection. The generation is bumped every time
+	//	the slot is released, so handles outliving their object are detected
+
+	template <typename Type_>
+	struct Handle
+	{
+		std::uint32_t slot;
+		std::uint32_t generation;
+
+		constexpr bool operator == (const Handle & other) const
+		{ return slot == other.slot && generation == other.generation; }
+
+		constexpr bool operator != (const Handle & other) const { return !(*this == other); }
+	};
+
+	namespace detail
+	{
+		//	Objects of one type packed in insertion order with holes filled
+		//	from the back. Slots map handles to positions and positions map
+		//	back to slots so that the object moved into a hole is re-pointed
+
+		template <typename Type_>
+		class Pool
+		{
+			struct Slot
+			{
+				std::uint32_t position;			//	next free slot while released
+				std::uint32_t generation;
+			};
+
+			static constexpr std::uint32_t none = ~std::uint32_t{ 0 };
+
+			std::vector<Type_> objects_;
+			std::vector<std::uint32_t> owners_;	//	slot of every object
+			std::vector<Slot> slots_;
+			std::uint32_t free_ = none;
+
+			//	room for one more entry with geometric growth, so that the
+			//	push_back that follows cannot throw
+			template <typename Entry_>
+			static void reserve_one(std::vector<Entry_> & entries)
+			{
+				if (entries.size() == entries.capacity()) entries.reserve(entries.empty() ? 8 : 2 * entries.size());
+			}
+
+		public:
+
+			std::vector<Type_> & objects(void) { return objects_; }
+			const std::vector<Type_> & objects(void) const { return objects_; }
+
+			bool contains(Handle<Type_> handle) const
+			{ return handle.slot < slots_.size() && slots_[handle.slot].generation == handle.generation; }
+
+			Type_ & get(Handle<Type_> handle)
+			{
+				assert(contains(handle) && "stale handle");
+				return objects_[slots_[handle.slot].position];
+			}
+
+			const Type_ & get(Handle<Type_> handle) const
+			{
+				assert(contains(handle) && "stale handle");
+				return objects_[slots_[handle.slot].position];
+			}
+
+			template <typename... Args_>
+			Handle<Type_> emplace(Args_ &&... args)
+			{
+				//	the bookkeeping grows first, a throw from the object or
+				//	its storage then leaves the pool unchanged
+				reserve_one(owners_);
+				if (free_ == none) reserve_one(slots_);
+
+				//	aggregates are brace initialised
+				if constexpr (std::is_constructible_v<Type_, Args_ &&...>)
+					objects_.emplace_back(std::forward<Args_>(args)...);
+				else
+					objects_.push_back(Type_{ std::forward<Args_>(args)... });
+
+				std::uint32_t slot = free_;
+				if (slot == none)
+				{
+					slot = static_cast<std::uint32_t>(slots_.size());
+					slots_.push_back({ 0, 0 });
+				}
+				else free_ = slots_[slot].position;
+
+				slots_[slot].position = static_cast<std::uint32_t>(objects_.size() - 1);
+				owners_.push_back(slot);
+				return { slot, slots_[slot].generation };
+			}
+
+			bool erase(Handle<Type_> handle)
+			{
+				if (!contains(handle)) return false;
+
+				Slot & slot = slots_[handle.slot];
+				const std::uint32_t last = static_cast<std::uint32_t>(objects_.size() - 1);
+
+				if (slot.position != last)
+				{
+					objects_[slot.position] = std::move(objects_[last]);
+					owners_[slot.position] = owners_[last];
+					slots_[owners_[last]].position = slot.position;
+				}
+				objects_.pop_back();
+				owners_.pop_back();
+
+				++slot.generation;
+				slot.position = free_;
+				free_ = handle.slot;
+				return true;
+			}
+
+			void reserve(std::size_t size)
+			{
+				objects_.reserve(size);
+				owners_.reserve(size);
+				slots_.reserve(size);
+			}
+
+			//	every outstanding handle is invalidated
+			void clear(void)
+			{
+				for (std::uint32_t slot : owners_)
+				{
+					++slots_[slot].generation;
+					slots_[slot].position = free_;
+					free_ = slot;
+				}
+				objects_.clear();
+				owners_.clear();
+			}
+		};
+	}
+
+	template <typename Types_>
+	class Collection;
+
+	//	Heterogeneous collection of a closed set of concrete types, each stored
+	//	contiguously. Iteration runs one loop per type, so calls on the objects
+	//	are resolved statically and inline, and insertion and erasure by handle
+	//	are O(1). Erasure moves the last object of the type into the hole, so
+	//	the order within a type is not kept
+
+	template <typename... Types_>
+	class Collection<TVector<Types_...>>
+	{
+		static_assert(!detail::has_duplicate_types<Types_...>(), "collection types must be unique");
+
+		using types_t = TVector<Types_...>;
+
+		std::tuple<detail::Pool<Types_>...> pools_;
+
+		template <typename Type_>
+		detail::Pool<Type_> & pool(void) { return std::get<type_id<Type_>(types_t{})>(pools_); }
+
+		template <typename Type_>
+		const detail::Pool<Type_> & pool(void) const { return std::get<type_id<Type_>(types_t{})>(pools_); }
+
+	public:
+
+		template <typename Type_, typename... Args_>
+		Handle<Type_> emplace(Args_ &&... args) { return pool<Type_>().emplace(std::forward<Args_>(args)...); }
+
+		template <typename Type_>
+		Handle<std::decay_t<Type_>> insert(Type_ && object)
+		{ return emplace<std::decay_t<Type_>>(std::forward<Type_>(object)); }
+
+		//	false when the handle is stale
+		template <typename Type_>
+		bool erase(Handle<Type_> handle) { return pool<Type_>().erase(handle); }
+
+		template <typename Type_>
+		bool contains(Handle<Type_> handle) const { return pool<Type_>().contains(handle); }
+
+		template <typename Type_>
+		Type_ & get(Handle<Type_> handle) { return pool<Type_>().get(handle); }
+
+		template <typename Type_>
+		const Type_ & get(Handle<Type_> handle) const { return pool<Type_>().get(handle); }
+
+		template <typename Type_>
+		Type_ * find(Handle<Type_> handle) { return contains(handle) ? &get(handle) : nullptr; }
+
+		template <typename Type_>
+		const Type_ * find(Handle<Type_> handle) const { return contains(handle) ? &get(handle) : nullptr; }
+
+		//	the contiguous objects of one type
+		template <typename Type_>
+		const std::vector<Type_> & objects(Type<Type_>) const { return pool<Type_>().objects(); }
+
+		template <typename Type_>
+		std::size_t size(Type<Type_> type) const { return objects(type).size(); }
+
+		std::size_t size(void) const { return (size(type_c<Types_>) + ... + 0); }
+		bool empty(void) const { return size() == 0; }
+
+		template <typename Type_>
+		void reserve(Type<Type_>, std::size_t size) { pool<Type_>().reserve(size); }
+
+		void clear(void) { (pool<Types_>().clear(), ...); }
+
+		//	function(object) over every object, type by type in the order of
+		//	the vector; function must not insert into or erase from this
+
+		template <typename Function_>
+		void for_each(Function_ && function)
+		{
+			(for_each(type_c<Types_>, function), ...);
+		}
+
+		template <typename Function_>
+		void for_each(Function_ && function) const
+		{
+			(for_each(type_c<Types_>, function), ...);
+		}
+
+		template <typename Type_, typename Function_>
+		void for_each(Type<Type_>, Function_ && function)
+		{
+			for (Type_ & object : pool<Type_>().objects()) function(object);
+		}
+
+		template <typename Type_, typename Function_>
+		void for_each(Type<Type_>, Function_ && function) const
+		{
+			for (const Type_ & object : pool<Type_>().objects()) function(object);
+		}
+	};
+}
+
+#endif	//	_SIGMA_API_META_CONTAINER_COLLECTION_HPP_
\ No newline at end of file
@@ -0,0 +1,195 @@
+#ifndef		_SIGMA_API_META_CONTAINER_PACKED_HPP_
+#define		_SIGMA_API_META_CONTAINER_PACKED_HPP_
+
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include "vector.hpp"
+
+namespace sigma::meta
+{
+	namespace detail
+	{
+		//	smallest unsigned integral holding bits_ bits, bits_ <= 64
+
+		template <std::size_t bits_>
+		inline constexpr auto unsigned_for(void)
+		{
+			if constexpr (bits_ <= 8) return type_c<std::uint8_t>;
+			else if constexpr (bits_ <= 16) return type_c<std::uint16_t>;
+			else if constexpr (bits_ <= 32) return type_c<std::uint32_t>;
+			else return type_c<std::uint64_t>;
+		}
+
+		template <std::size_t bits_>
+		using unsigned_for_t = typename decltype(unsigned_for<bits_>())::type_t;
+	}
+
+	template <typename Widths_>
+	class PackedRecord;
+
+	//	Record of bit fields laid out back to back, field i occupies
+	//	widths_[i] bits starting at the sum of the preceding widths.
+	//	Storage is the smallest unsigned word fitting all fields, or
+	//	an array of 64 bit words past 64 bits; a field only straddles
+	//	two words in the latter case
+
+	template <auto... widths_>
+	class PackedRecord<VVector<widths_...>>
+	{
+		static_assert(sizeof...(widths_) != 0, "packed record requires fields");
+		static_assert(((widths_ > 0 && widths_ <= 64) && ...),
+			"packed field widths must be within [1, 64]");
+
+		static constexpr std::size_t widths[] = { static_cast<std::size_t>(widths_)... };
+
+	public:
+
+		static constexpr std::size_t size(void) { return sizeof...(widths_); }
+		static constexpr std::size_t bits(void) { return (static_cast<std::size_t>(widths_) + ...); }
+
+		using word_t = std::conditional_t<(bits() <= 64), detail::unsigned_for_t<bits()>, std::uint64_t>;
+
+		static constexpr std::size_t word_bits = sizeof(word_t) * 8;
+		static constexpr std::size_t word_count = (bits() + word_bits - 1) / word_bits;
+
+		template <std::size_t index_>
+		static constexpr std::size_t width(std::integral_constant<std::size_t, index_>)
+		{
+			static_assert(index_ < size(), "index is out of bounds");
+			return widths[index_];
+		}
+
+		template <std::size_t index_>
+		static constexpr std::size_t offset(std::integral_constant<std::size_t, index_>)
+		{
+			static_assert(index_ < size(), "index is out of bounds");
+			std::size_t result = 0;
+			for (std::size_t index = 0; index < index_; ++index) result += widths[index];
+			return result;
+		}
+
+		template <std::size_t index_>
+		static constexpr std::uint64_t mask(std::integral_constant<std::size_t, index_> index)
+		{ return width(index) == 64 ? ~std::uint64_t{ 0 } : (std::uint64_t{ 1 } << width(index)) - 1; }
+
+		template <std::size_t index_>
+		using value_t = detail::unsigned_for_t<widths[index_]>;
+
+	private:
+
+		template <std::size_t index_>
+		static constexpr std::size_t word_of = offset(std::integral_constant<std::size_t, index_>{}) / word_bits;
+
+		template <std::size_t index_>
+		static constexpr std::size_t shift_of = offset(std::integral_constant<std::size_t, index_>{}) % word_bits;
+
+		template <std::size_t index_>
+		static constexpr bool straddles = shift_of<index_> + widths[index_] > word_bits;
+
+		word_t words_[word_count] = {};
+
+		template <std::size_t... indices_, typename... Values_>
+		constexpr void assign(std::index_sequence<indices_...>, Values_... values)
+		{ (set(std::integral_constant<std::size_t, indices_>{}, values), ...); }
+
+	public:
+
+		constexpr PackedRecord(void) = default;
+
+		template <typename... Values_, typename = std::enable_if_t<sizeof...(Values_) == sizeof...(widths_)>>
+		constexpr PackedRecord(Values_... values)
+		{ assign(std::make_index_sequence<sizeof...(widths_)>{}, values...); }
+
+		template <std::size_t index_>
+		constexpr value_t<index_> get(std::integral_constant<std::size_t, index_> index) const
+		{
+			constexpr std::size_t word = word_of<index_>;
+			constexpr std::size_t shift = shift_of<index_>;
+
+			if constexpr (straddles<index_>)
+			{
+				const std::uint64_t low = static_cast<std::uint64_t>(words_[word]) >> shift;
+				const std::uint64_t high = static_cast<std::uint64_t>(words_[word + 1]) << (word_bits - shift);
+				return static_cast<value_t<index_>>((low | high) & mask(index));
+			}
+			else
+				return static_cast<value_t<index_>>((static_cast<std::uint64_t>(words_[word]) >> shift) & mask(index));
+		}
+
+		template <std::size_t index_>
+		constexpr value_t<index_> get(void) const { return get(std::integral_constant<std::size_t, index_>{}); }
+
+		template <std::size_t index_>
+		constexpr value_t<index_> operator[] (std::integral_constant<std::size_t, index_> index) const
+		{ return get(index); }
+
+		//	values wider than the field are truncated to its width
+
+		template <std::size_t index_, typename Value_>
+		constexpr void set(std::integral_constant<std::size_t, index_> index, Value_ value)
+		{
+			static_assert(std::is_integral_v<Value_> || std::is_enum_v<Value_>,
+				"packed fields hold integral values");
+
+			constexpr std::size_t word = word_of<index_>;
+			constexpr std::size_t shift = shift_of<index_>;
+
+			const std::uint64_t bits = static_cast<std::uint64_t>(value) & mask(index);
+			const std::uint64_t low_mask = mask(index) << shift;
+
+			words_[word] = static_cast<word_t>((words_[word] & ~low_mask) | (bits << shift));
+
+			if constexpr (straddles<index_>)
+			{
+				const std::uint64_t high_mask = mask(index) >> (word_bits - shift);
+				words_[word + 1] = static_cast<word_t>((words_[word + 1] & ~high_mask) | (bits >> (word_bits - shift)));
+			}
+		}
+
+		template <std::size_t index_, typename Value_>
+		constexpr void set(Value_ value) { set(std::integral_constant<std::size_t, index_>{}, value); }
+
+		constexpr bool operator == (const PackedRecord & other) const
+		{
+			for (std::size_t word = 0; word < word_count; ++word)
+				if (words_[word] != other.words_[word]) return false;
+			return true;
+		}
+
+		constexpr bool operator != (const PackedRecord & other) const { return !(*this == other); }
+	};
+
+	//		**	BATCH ACCESS **
+
+	//	extracts one field across a contiguous run of records, the loop body
+	//	is a fixed load / shift / mask so the compiler vectorises it
+
+	template <std::size_t index_, typename Widths_>
+	inline void extract(std::integral_constant<std::size_t, index_> index,
+		const PackedRecord<Widths_> * records, std::size_t count,
+		typename PackedRecord<Widths_>::template value_t<index_> * output)
+	{
+		for (std::size_t record = 0; record < count; ++record)
+			output[record] = records[record].get(index);
+	}
+
+	template <std::size_t index_, typename Widths_>
+	inline void extract(const PackedRecord<Widths_> * records, std::size_t count,
+		typename PackedRecord<Widths_>::template value_t<index_> * output)
+	{ extract(std::integral_constant<std::size_t, index_>{}, records, count, output); }
+
+	template <std::size_t index_, typename Widths_, typename Value_>
+	inline void scatter(std::integral_constant<std::size_t, index_> index,
+		PackedRecord<Widths_> * records, std::size_t count, const Value_ * input)
+	{
+		for (std::size_t record = 0; record < count; ++record)
+			records[record].set(index, input[record]);
+	}
+
+	template <std::size_t index_, typename Widths_, typename Value_>
+	inline void scatter(PackedRecord<Widths_> * records, std::size_t count, const Value_ * input)
+	{ scatter(std::integral_constant<std::size_t, index_>{}, records, count, input); }
+}
+
+#endif	//	_SIGMA_API_META_CONTAINER_PACKED_HPP_
\ No newline at end of file
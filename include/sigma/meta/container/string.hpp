@@ -0,0 +1,67 @@
+#ifndef		_SIGMA_API_META_CONTAINER_STRING_HPP_
+#define		_SIGMA_API_META_CONTAINER_STRING_HPP_
+
+#include <string_view>
+#include <type_traits>
+#include "traits.hpp"
+
+namespace sigma::meta
+{
+	//	String whose characters live in the type, so it can be
+	//	passed as a template argument and compared at compile time
+
+	template <char... chars_>
+	class String
+	{
+		static constexpr char storage_[] = { chars_..., '\0' };
+
+	public:
+
+		static constexpr std::size_t size(void) { return sizeof...(chars_); }
+		static constexpr const char * data(void) { return storage_; }
+		static constexpr const char * c_str(void) { return storage_; }
+		static constexpr std::string_view view(void) { return std::string_view(storage_, size()); }
+
+		template <std::size_t index_>
+		static constexpr char get(std::integral_constant<std::size_t, index_>)
+		{
+			static_assert(index_ < size(), "index is out of bounds");
+			return storage_[index_];
+		}
+
+		template <std::size_t index_>
+		static constexpr char get(void) { return get(std::integral_constant<std::size_t, index_>{}); }
+
+		template <std::size_t index_>
+		constexpr char operator[] (std::integral_constant<std::size_t, index_> index) const
+		{ return get(index); }
+
+		static constexpr char front(void) { return get<0>(); }
+		static constexpr char back(void) { return get<size() - 1>(); }
+
+		constexpr operator std::string_view (void) const { return view(); }
+
+		template <char... others_>
+		constexpr bool operator == (String<others_...>) const { return false; }
+		constexpr bool operator == (String<chars_...>) const { return true; }
+
+		template <char... others_>
+		constexpr bool operator != (String<others_...> other) const { return !(*this == other); }
+	};
+
+	inline namespace literals
+	{
+		//	string literal operator template, a GNU extension
+		//	supported by both gcc and clang
+
+		template <typename Char_, Char_... chars_>
+		inline constexpr auto operator"" _s(void)
+		{
+			static_assert(std::is_same_v<Char_, char>,
+				"only narrow string literals are supported");
+			return String<chars_...>{};
+		}
+	}
+}
+
+#endif	//	_SIGMA_API_META_CONTAINER_STRING_HPP_
\ No newline at end of file
@@ -0,0 +1,141 @@
+#ifndef		_SIGMA_API_META_CONTAINER_TYPE_MAP_HPP_
+#define		_SIGMA_API_META_CONTAINER_TYPE_MAP_HPP_
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include "vector.hpp"
+
+namespace sigma::meta
+{
+	namespace detail
+	{
+		//	position of Type_ among Types_, sizeof...(Types_) when absent
+
+		template <typename Type_, typename... Types_>
+		inline constexpr std::size_t type_index(void)
+		{
+			constexpr bool matches[] = { std::is_same_v<Type_, Types_>..., false };
+
+			std::size_t index = 0;
+			while (index < sizeof...(Types_) && !matches[index]) ++index;
+			return index;
+		}
+
+		template <typename... Types_>
+		inline constexpr bool has_duplicate_types(void)
+		{
+			constexpr std::size_t indices[] = { type_index<Types_, Types_...>()..., 0 };
+
+			for (std::size_t index = 0; index < sizeof...(Types_); ++index)
+				if (indices[index] != index) return true;
+			return false;
+		}
+	}
+
+	//	Dense ids of the types of a vector, the position of the first match.
+	//	They are constants, so no RTTI is needed and tables keyed by them are
+	//	indexed directly
+
+	template <typename Type_, typename... Types_>
+	inline constexpr std::size_t type_id(TVector<Types_...>)
+	{
+		constexpr std::size_t id = detail::type_index<Type_, Types_...>();
+		static_assert(id < sizeof...(Types_), "type is not an element of the vector");
+		return id;
+	}
+
+	template <typename Type_, typename... Types_>
+	inline constexpr std::size_t type_id(TVector<Types_...> types, Type<Type_>) { return type_id<Type_>(types); }
+
+	template <typename Type_, typename... Types_>
+	inline constexpr bool contains(TVector<Types_...>, Type<Type_>)
+	{ return detail::type_index<Type_, Types_...>() < sizeof...(Types_); }
+
+	template <typename Keys_, typename Value_>
+	class TypeMap;
+
+	//	One value per key type in a plain array ordered by type_id, so a
+	//	lookup by type is a single load at a constant offset and a lookup
+	//	by a runtime id a single indexed load
+
+	template <typename... Keys_, typename Value_>
+	class TypeMap<TVector<Keys_...>, Value_>
+	{
+		static_assert(!detail::has_duplicate_types<Keys_...>(), "type map keys must be unique");
+
+		std::array<Value_, sizeof...(Keys_)> values_{};
+
+	public:
+
+		using keys_t = TVector<Keys_...>;
+		using value_t = Value_;
+
+		constexpr TypeMap(void) = default;
+		constexpr explicit TypeMap(const Value_ & value) { for (auto & element : values_) element = value; }
+
+		static constexpr std::size_t size(void) { return sizeof...(Keys_); }
+
+		template <typename Key_>
+		static constexpr std::size_t id(Type<Key_> key) { return type_id(keys_t{}, key); }
+
+		template <typename Key_>
+		constexpr Value_ & get(Type<Key_> key) { return values_[id(key)]; }
+
+		template <typename Key_>
+		constexpr const Value_ & get(Type<Key_> key) const { return values_[id(key)]; }
+
+		template <typename Key_>
+		constexpr Value_ & get(void) { return get(type_c<Key_>); }
+
+		template <typename Key_>
+		constexpr const Value_ & get(void) const { return get(type_c<Key_>); }
+
+		template <typename Key_>
+		constexpr Value_ & operator[] (Type<Key_> key) { return get(key); }
+
+		template <typename Key_>
+		constexpr const Value_ & operator[] (Type<Key_> key) const { return get(key); }
+
+		//	by an id obtained from type_id, unchecked
+		constexpr Value_ & at(std::size_t id) { return values_[id]; }
+		constexpr const Value_ & at(std::size_t id) const { return values_[id]; }
+
+		constexpr Value_ * data(void) { return values_.data(); }
+		constexpr const Value_ * data(void) const { return values_.data(); }
+
+		constexpr Value_ * begin(void) { return values_.data(); }
+		constexpr Value_ * end(void) { return values_.data() + size(); }
+		constexpr const Value_ * begin(void) const { return values_.data(); }
+		constexpr const Value_ * end(void) const { return values_.data() + size(); }
+
+		//	function(type_c<Key>, value) for every key in id order
+
+		template <typename Function_>
+		constexpr void for_each(Function_ function)
+		{ (function(type_c<Keys_>, get(type_c<Keys_>)), ...); }
+
+		template <typename Function_>
+		constexpr void for_each(Function_ function) const
+		{ (function(type_c<Keys_>, get(type_c<Keys_>)), ...); }
+
+		friend constexpr bool operator == (const TypeMap & lhs, const TypeMap & rhs)
+		{
+			for (std::size_t index = 0; index < size(); ++index)
+				if (!(lhs.values_[index] == rhs.values_[index])) return false;
+			return true;
+		}
+
+		friend constexpr bool operator != (const TypeMap & lhs, const TypeMap & rhs) { return !(lhs == rhs); }
+	};
+
+	template <typename Value_, typename... Keys_>
+	inline constexpr auto type_map(TVector<Keys_...>) { return TypeMap<TVector<Keys_...>, Value_>{}; }
+
+	template <typename Value_, typename... Keys_>
+	inline constexpr auto type_map(TVector<Keys_...>, const Value_ & value)
+	{ return TypeMap<TVector<Keys_...>, Value_>(value); }
+}
+
+#endif	//	_SIGMA_API_META_CONTAINER_TYPE_MAP_HPP_
\ No newline at end of file
@@ -0,0 +1,71 @@
+#	Compile time of LookupTable above an empty translation unit
+#
+#	python3 lookup_table_compile_time.py [--compiler g++] [--repeats 3] [sizes...]
+#
+#	Every measurement compiles one generated translation unit that
+#	instantiates a table of the CRC-32 byte step over Range<0u, size>,
+#	with element::Natural and element::Compact, and keeps the fastest of
+#	the repeats. The figures are printed as a table in seconds
+
+import argparse
+import os
+import subprocess
+import tempfile
+import time
+
+include = os.path.abspath(os.path.join(os.path.dirname(__file__), '..', '..', '..', '..'))
+
+source = '''#include <cstdint>
+#include <sigma/meta/algorithm/lookup_table.hpp>
+
+using namespace sigma::meta;
+
+constexpr std::uint32_t crc32(std::uint32_t key)
+{
+	for (int bit = 0; bit < 8; ++bit) key = key & 1 ? (key >> 1) ^ 0xedb88320u : key >> 1;
+	return key & 0xff;
+}
+
+%s
+
+int main(void) {}
+'''
+
+table = 'const void * table(void) { return LookupTable<crc32, Range<0u, %du>, %s>::data(); }'
+
+
+def compile_seconds(arguments, directory, body):
+	path = os.path.join(directory, 'table.cpp')
+	with open(path, 'w') as file:
+		file.write(source % body)
+
+	command = [arguments.compiler, '-std=c++1z', '-fconcepts', '-O2', '-c', '-I' + include, path,
+		'-o', os.path.join(directory, 'table.o')]
+
+	best = float('inf')
+	for _ in range(arguments.repeats):
+		start = time.perf_counter()
+		subprocess.run(command, check=True)
+		best = min(best, time.perf_counter() - start)
+	return best
+
+
+def main():
+	parser = argparse.ArgumentParser(description='compile time of sigma::meta::LookupTable')
+	parser.add_argument('--compiler', default='g++')
+	parser.add_argument('--repeats', type=int, default=3)
+	parser.add_argument('sizes', type=int, nargs='*', default=[256, 4096, 65536])
+	arguments = parser.parse_args()
+
+	with tempfile.TemporaryDirectory() as directory:
+		empty = compile_seconds(arguments, directory, '')
+
+		print('%-10s %10s %10s' % ('entries', 'natural', 'compact'))
+		for size in arguments.sizes:
+			natural = max(compile_seconds(arguments, directory, table % (size, 'element::Natural')) - empty, 0)
+			compact = max(compile_seconds(arguments, directory, table % (size, 'element::Compact')) - empty, 0)
+			print('%-10d %9.2fs %9.2fs' % (size, natural, compact))
+
+
+if __name__ == '__main__':
+	main()
\ No newline at end of file
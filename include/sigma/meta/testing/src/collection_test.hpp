@@ -0,0 +1,133 @@
+#ifndef		_SIGMA_API_META_TESTING_COLLECTION_TEST_HPP_
+#define		_SIGMA_API_META_TESTING_COLLECTION_TEST_HPP_
+
+#include <cassert>
+#include <string>
+#include <vector>
+
+#include <sigma/meta/container/collection.hpp>
+
+using namespace sigma::meta;
+
+struct Circle { double radius; double area(void) const { return 3 * radius * radius; } };
+struct Square { double side; double area(void) const { return side * side; } };
+struct Label { std::string text; double area(void) const { return 0; } };
+
+using shapes_t = Collection<TVector<Circle, Square, Label>>;
+
+struct Fragile
+{
+	int value;
+	explicit Fragile(int value) : value(value) { if (value < 0) throw value; }
+};
+
+// handles stay valid across erasure of other objects
+void collection_handle_test(void)
+{
+	shapes_t shapes;
+
+	const auto c1 = shapes.emplace<Circle>(1.0);
+	const auto c2 = shapes.insert(Circle{ 2.0 });
+	const auto c3 = shapes.emplace<Circle>(3.0);
+	const auto s1 = shapes.insert(Square{ 4.0 });
+	const auto l1 = shapes.insert(Label{ "one" });
+
+	assert(shapes.size() == 5);
+	assert(shapes.size(type_c<Circle>) == 3);
+	assert(shapes.get(c2).radius == 2.0 && shapes.get(l1).text == "one");
+
+	//	Test erasing moves the last object into the hole
+
+	assert(shapes.erase(c1));
+	assert(!shapes.contains(c1) && shapes.find(c1) == nullptr);
+	assert(!shapes.erase(c1));
+	assert(shapes.objects(type_c<Circle>)[0].radius == 3.0);
+	assert(shapes.get(c3).radius == 3.0 && shapes.get(c2).radius == 2.0);
+
+	//	Test released slots are reused with a new generation
+
+	const auto c4 = shapes.emplace<Circle>(5.0);
+	assert(c4.slot == c1.slot && c4 != c1);
+	assert(shapes.get(c4).radius == 5.0 && !shapes.contains(c1));
+
+	//	Test erasing the last object and every type independently
+
+	assert(shapes.erase(c4) && shapes.erase(s1));
+	assert(shapes.size(type_c<Square>) == 0 && shapes.size() == 3);
+	assert(shapes.get(c2).radius == 2.0 && shapes.get(c3).radius == 3.0);
+
+	shapes.clear();
+	assert(shapes.empty() && !shapes.contains(c2) && !shapes.contains(l1));
+
+	const auto l2 = shapes.insert(Label{ "two" });
+	assert(shapes.contains(l2) && shapes.get(l2).text == "two");
+}
+
+// iteration runs type by type over the live objects
+void collection_iteration_test(void)
+{
+	shapes_t shapes;
+	std::vector<Handle<Square>> squares;
+
+	for (int index = 0; index < 100; ++index)
+	{
+		shapes.emplace<Circle>(1.0);
+		squares.push_back(shapes.emplace<Square>(static_cast<double>(index)));
+	}
+	shapes.insert(Label{ "text" });
+
+	for (int index = 0; index < 100; index += 2) shapes.erase(squares[index]);
+
+	double total = 0;
+	shapes.for_each([&](const auto & shape) { total += shape.area(); });
+
+	double expected = 100 * 3.0;
+	for (int index = 1; index < 100; index += 2) expected += index * index;
+	assert(total == expected);
+
+	//	Test per type iteration and mutation
+
+	shapes.for_each(type_c<Circle>, [](Circle & circle) { circle.radius = 2.0; });
+
+	std::size_t visited = 0;
+	const shapes_t & view = shapes;
+	view.for_each(type_c<Circle>, [&](const Circle & circle) { visited += circle.radius == 2.0; });
+	assert(visited == 100);
+
+	for (int index = 1; index < 100; index += 2) assert(view.get(squares[index]).side == index);
+}
+
+// a throwing constructor leaves the collection unchanged
+void collection_exception_test(void)
+{
+	Collection<TVector<Fragile>> fragiles;
+
+	bool thrown = false;
+	try { fragiles.emplace<Fragile>(-1); }
+	catch (int) { thrown = true; }
+	assert(thrown && fragiles.empty());
+
+	const auto f1 = fragiles.emplace<Fragile>(1);
+	assert(f1.slot == 0 && fragiles.get(f1).value == 1);
+
+	//	Test a released slot stays free across the throw
+
+	assert(fragiles.erase(f1));
+	thrown = false;
+	try { fragiles.emplace<Fragile>(-2); }
+	catch (int) { thrown = true; }
+	assert(thrown && fragiles.empty());
+
+	const auto f2 = fragiles.emplace<Fragile>(2);
+	assert(f2.slot == f1.slot && f2 != f1 && fragiles.size() == 1);
+	assert(fragiles.erase(f2) && fragiles.empty());
+}
+
+void collection_test_main(void)
+{
+	collection_handle_test();
+	collection_iteration_test();
+	collection_exception_test();
+}
+
+#endif	//	_SIGMA_API_META_TESTING_COLLECTION_TEST_HPP_
\ No newline at end of file
@@ -0,0 +1,115 @@
+#ifndef		_SIGMA_API_META_TESTING_LOOKUP_TABLE_TEST_HPP_
+#define		_SIGMA_API_META_TESTING_LOOKUP_TABLE_TEST_HPP_
+
+#include <cassert>
+#include <cstdint>
+#include <type_traits>
+
+#include <sigma/meta/algorithm/lookup_table.hpp>
+
+using namespace sigma::meta;
+
+namespace lookup_table_test
+{
+	constexpr int popcount(unsigned key)
+	{
+		int count = 0;
+		for (; key; key &= key - 1) ++count;
+		return count;
+	}
+
+	constexpr std::uint32_t crc32(std::uint32_t key)
+	{
+		for (int bit = 0; bit < 8; ++bit) key = key & 1 ? (key >> 1) ^ 0xedb88320u : key >> 1;
+		return key;
+	}
+
+	constexpr bool is_identifier(char key)
+	{ return key == '_' || (key >= 'a' && key <= 'z') || (key >= 'A' && key <= 'Z') || (key >= '0' && key <= '9'); }
+
+	//	index of the highest set bit, -1 for zero
+	constexpr int log_bucket(long long key)
+	{
+		int bucket = -1;
+		for (; key > 0; key >>= 1) ++bucket;
+		return bucket;
+	}
+
+	constexpr double square(int key) { return 0.5 * key * key; }
+}
+
+// compile time types, layouts and values
+void lookup_table_static_test(void)
+{
+	using namespace lookup_table_test;
+
+	using popcount_t = LookupTable<popcount, Range<0u, 65536u>, element::Compact>;
+	using crc_t = LookupTable<crc32, Range<0u, 256u>>;
+	using class_t = LookupTable<is_identifier, Range<char{ 0 }, char{ 127 }>>;
+	using bucket_t = LookupTable<log_bucket, Range<0ll, 100ll>, element::Compact, layout::Gather>;
+	using sparse_t = LookupTable<square, VVector<2, 3, 5, 7, 11>, float>;
+
+	//	Test element types
+
+	static_assert(std::is_same_v<popcount_t::element_t, std::uint8_t>);
+	static_assert(std::is_same_v<crc_t::element_t, std::uint32_t>);
+	static_assert(std::is_same_v<class_t::element_t, bool>);
+	static_assert(std::is_same_v<bucket_t::element_t, std::int32_t>);
+	static_assert(std::is_same_v<sparse_t::element_t, float>);
+	static_assert(std::is_same_v<LookupTable<log_bucket, Range<0ll, 100ll>, element::Compact>::element_t,
+		std::int8_t>);
+
+	//	Test sizes, padding and alignment
+
+	static_assert(popcount_t::size() == 65536 && popcount_t::capacity() == 65536);
+	static_assert(bucket_t::size() == 100 && bucket_t::capacity() == 112);
+	static_assert(LookupTable<crc32, Range<0u, 0u>>::capacity() == 1);
+	static_assert(LookupTable<crc32, Range<0u, 0u>, element::Natural, layout::Gather>::capacity() == 16);
+
+	//	Test values at compile time
+
+	static_assert(popcount_t::get(0xffff) == 16);
+	static_assert(popcount_t::at(0x1234) == 5);
+	static_assert(crc_t::at(1) == 0x77073096u);
+	static_assert(class_t::at('_') && class_t::at('7') && !class_t::at('-'));
+	static_assert(bucket_t::at(0) == -1 && bucket_t::at(64) == 6 && bucket_t::get(99) == 6);
+	static_assert(sparse_t::get(4) == 60.5f);
+	static_assert(lookup_table<square, VVector<2, 3, 5, 7, 11>, float>[1] == 4.5f);
+}
+
+// tables are aligned read only data agreeing with the function at run time
+void lookup_table_runtime_test(void)
+{
+	using namespace lookup_table_test;
+
+	using popcount_t = LookupTable<popcount, Range<0u, 65536u>, element::Compact>;
+	using bucket_t = LookupTable<log_bucket, Range<0ll, 100ll>, element::Compact, layout::Gather>;
+
+	assert(reinterpret_cast<std::uintptr_t>(popcount_t::data()) % popcount_t::alignment == 0);
+	assert(reinterpret_cast<std::uintptr_t>(bucket_t::data()) % bucket_t::alignment == 0);
+
+	for (unsigned key = 0; key < 65536; ++key)
+		assert(popcount_t::at(key) == __builtin_popcount(key));
+
+	std::size_t count = 0;
+	for (auto value : popcount_t{}) count += value;
+	assert(count == 16 * 32768);
+
+	for (std::size_t index = bucket_t::size(); index < bucket_t::capacity(); ++index)
+		assert(bucket_t::data()[index] == 0);
+
+	//	Test empty domains still have aligned storage
+
+	using empty_t = LookupTable<crc32, Range<0u, 0u>, element::Compact, layout::Gather>;
+
+	assert(empty_t::begin() == empty_t::end());
+	assert(reinterpret_cast<std::uintptr_t>(empty_t::data()) % empty_t::alignment == 0 && empty_t::data()[0] == 0);
+}
+
+void lookup_table_test_main(void)
+{
+	lookup_table_static_test();
+	lookup_table_runtime_test();
+}
+
+#endif	//	_SIGMA_API_META_TESTING_LOOKUP_TABLE_TEST_HPP_
\ No newline at end of file
@@ -1,6 +1,20 @@
 #include "container_test.hpp"
+#include "sorting_network_test.hpp"
+#include "packed_test.hpp"
+#include "string_test.hpp"
+#include "type_map_test.hpp"
+#include "collection_test.hpp"
+#include "state_machine_test.hpp"
+#include "lookup_table_test.hpp"
 
 int main(void)
 {
 	container_test_main();
+	sorting_network_test_main();
+	packed_test_main();
+	string_test_main();
+	type_map_test_main();
+	collection_test_main();
+	state_machine_test_main();
+	lookup_table_test_main();
 }
\ No newline at end of file
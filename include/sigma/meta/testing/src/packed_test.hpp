@@ -0,0 +1,127 @@
+#ifndef		_SIGMA_API_META_TESTING_PACKED_TEST_HPP_
+#define		_SIGMA_API_META_TESTING_PACKED_TEST_HPP_
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include <sigma/meta/container/packed.hpp>
+
+using namespace sigma::meta;
+
+// compile time layout tests
+void packed_layout_test(void)
+{
+	using r1_t = PackedRecord<VVector<3, 4>>;
+	using r2_t = PackedRecord<VVector<3, 13, 1, 47>>;
+	using r3_t = PackedRecord<VVector<60, 10, 64, 2>>;
+
+	//	Test storage selection
+
+	static_assert(sizeof(r1_t) == 1);
+	static_assert(sizeof(r2_t) == 8);
+	static_assert(sizeof(r3_t) == 24);
+	static_assert(std::is_same_v<r2_t::word_t, std::uint64_t>);
+
+	//	Test offsets, widths and masks
+
+	static_assert(r2_t::size() == 4);
+	static_assert(r2_t::bits() == 64);
+	static_assert(r2_t::offset(0_u) == 0);
+	static_assert(r2_t::offset(1_u) == 3);
+	static_assert(r2_t::offset(2_u) == 16);
+	static_assert(r2_t::offset(3_u) == 17);
+	static_assert(r2_t::width(3_u) == 47);
+	static_assert(r2_t::mask(0_u) == 0x7);
+	static_assert(r3_t::mask(2_u) == ~std::uint64_t{ 0 });
+
+	//	Test field value types
+
+	static_assert(std::is_same_v<r2_t::value_t<0>, std::uint8_t>);
+	static_assert(std::is_same_v<r2_t::value_t<1>, std::uint16_t>);
+	static_assert(std::is_same_v<r2_t::value_t<3>, std::uint64_t>);
+}
+
+// constexpr field access tests
+void packed_access_test(void)
+{
+	//	Test construction and reads
+	{
+		constexpr PackedRecord<VVector<3, 13, 1, 47>> r1(5, 8000, 1, 0x7fff'ffff'ffffull);
+
+		static_assert(r1.get<0>() == 5);
+		static_assert(r1.get<1>() == 8000);
+		static_assert(r1[2_u] == 1);
+		static_assert(r1[3_u] == 0x7fff'ffff'ffffull);
+	}
+
+	//	Test truncation and neighbours left untouched
+	{
+		constexpr auto r1 = []
+		{
+			PackedRecord<VVector<3, 4>> record(7, 15);
+			record.set<0>(9);
+			return record;
+		}();
+
+		static_assert(r1.get<0>() == 1);
+		static_assert(r1.get<1>() == 15);
+	}
+
+	//	Test fields straddling storage words
+	{
+		constexpr auto r1 = []
+		{
+			PackedRecord<VVector<60, 10, 64, 2>> record;
+			record.set<1>(0x2aa);
+			record.set<2>(0xfedc'ba98'7654'3210ull);
+			record.set<3>(3);
+			record.set<0>(0);
+			return record;
+		}();
+
+		static_assert(r1.get<0>() == 0);
+		static_assert(r1.get<1>() == 0x2aa);
+		static_assert(r1.get<2>() == 0xfedc'ba98'7654'3210ull);
+		static_assert(r1.get<3>() == 3);
+		static_assert(r1 == PackedRecord<VVector<60, 10, 64, 2>>(0, 0x2aa, 0xfedc'ba98'7654'3210ull, 3));
+	}
+}
+
+// batch extraction tests
+void packed_batch_test(void)
+{
+	using record_t = PackedRecord<VVector<3, 13, 1, 47>>;
+
+	std::vector<record_t> records(1000);
+	std::vector<std::uint16_t> input(records.size());
+	for (std::size_t index = 0; index < input.size(); ++index)
+	{
+		input[index] = static_cast<std::uint16_t>(index * 7919 % 8192);
+		records[index] = record_t(index, 0, index & 1, index * index);
+	}
+
+	scatter<1>(records.data(), records.size(), input.data());
+
+	std::vector<std::uint16_t> output(records.size());
+	std::vector<std::uint64_t> squares(records.size());
+	extract<1>(records.data(), records.size(), output.data());
+	extract(3_u, records.data(), records.size(), squares.data());
+
+	assert(output == input);
+	for (std::size_t index = 0; index < records.size(); ++index)
+	{
+		assert(squares[index] == index * index);
+		assert(records[index].get<0>() == (index & 7));
+		assert(records[index].get<2>() == (index & 1));
+	}
+}
+
+void packed_test_main(void)
+{
+	packed_layout_test();
+	packed_access_test();
+	packed_batch_test();
+}
+
+#endif	//	_SIGMA_API_META_TESTING_PACKED_TEST_HPP_
\ No newline at end of file
@@ -0,0 +1,134 @@
+#ifndef		_SIGMA_API_META_TESTING_SORTING_NETWORK_TEST_HPP_
+#define		_SIGMA_API_META_TESTING_SORTING_NETWORK_TEST_HPP_
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <random>
+
+#include <sigma/meta/algorithm/sorting_network.hpp>
+
+using namespace sigma::meta;
+
+// compile time generation and validation
+void sorting_network_generation_test(void)
+{
+	//	Test trivial sizes
+	{
+		static_assert(sorting_network<0>() == VVector<>{});
+		static_assert(sorting_network<1>() == VVector<>{});
+		static_assert(sorting_network<2>() == VVector<std::size_t{ 0 }, std::size_t{ 1 }>{});
+	}
+
+	//	Test comparator counts against known batcher sizes
+	{
+		static_assert(sorting_network<4>().size() == 2 * 5);
+		static_assert(sorting_network<8>().size() == 2 * 19);
+		static_assert(sorting_network<16>().size() == 2 * 63);
+		static_assert(sorting_network<32>().size() == 2 * 191);
+	}
+
+	//	Test generated networks with the zero-one principle
+	{
+		static_assert(is_sorting_network<3>(sorting_network<3>()));
+		static_assert(is_sorting_network<4>(sorting_network<4>()));
+		static_assert(is_sorting_network<5>(sorting_network<5>()));
+		static_assert(is_sorting_network<7>(sorting_network<7>()));
+		static_assert(is_sorting_network<8>(sorting_network<8>()));
+		static_assert(is_sorting_network<11>(sorting_network<11>()));
+		static_assert(is_sorting_network<12>(sorting_network<12>()));
+	}
+
+	//	Test user supplied networks
+	{
+		using optimal4_t = VVector<0, 1, 2, 3, 0, 2, 1, 3, 1, 2>;
+		using broken4_t = VVector<0, 1, 2, 3, 0, 2, 1, 3>;
+
+		static_assert(is_sorting_network<4>(optimal4_t{}));
+		static_assert(!is_sorting_network<4>(broken4_t{}));
+	}
+}
+
+template <std::size_t size_>
+void sorting_network_runtime_test(std::mt19937 & engine)
+{
+	std::uniform_int_distribution<int> distribution(-50, 50);
+
+	for (int repeat = 0; repeat < 100; ++repeat)
+	{
+		std::array<int, size_> values;
+		std::array<double, size_> reals;
+		for (std::size_t index = 0; index < size_; ++index)
+		{
+			values[index] = distribution(engine);
+			reals[index] = values[index] * 0.5;
+		}
+
+		auto expected = values;
+		std::sort(expected.begin(), expected.end());
+
+		network_sort(values);
+		network_sort(reals);
+
+		assert(values == expected);
+		assert(std::is_sorted(reals.begin(), reals.end()));
+	}
+}
+
+// lane sorting against per-column sorting, over whole registers and partial ones
+template <typename Type_, std::size_t size_, std::size_t lanes_>
+void sorting_network_lanes_test(std::mt19937 & engine)
+{
+	std::uniform_int_distribution<int> distribution(-50, 50);
+
+	Type_ block[size_ * lanes_];
+	for (auto & value : block) value = static_cast<Type_>(distribution(engine));
+
+	Type_ expected[lanes_][size_];
+	for (std::size_t lane = 0; lane < lanes_; ++lane)
+	{
+		for (std::size_t index = 0; index < size_; ++index)
+			expected[lane][index] = block[index * lanes_ + lane];
+		std::sort(expected[lane], expected[lane] + size_);
+	}
+
+	network_sort_lanes<size_, lanes_>(block);
+
+	for (std::size_t lane = 0; lane < lanes_; ++lane)
+		for (std::size_t index = 0; index < size_; ++index)
+			assert(block[index * lanes_ + lane] == expected[lane][index]);
+}
+
+template <std::size_t size_>
+void sorting_network_lanes_test(std::mt19937 & engine)
+{
+	sorting_network_lanes_test<float, size_, 3>(engine);
+	sorting_network_lanes_test<float, size_, 8>(engine);
+	sorting_network_lanes_test<float, size_, 32>(engine);
+	sorting_network_lanes_test<double, size_, 16>(engine);
+	sorting_network_lanes_test<int, size_, 16>(engine);
+	sorting_network_lanes_test<short, size_, 32>(engine);
+}
+
+void sorting_network_test_main(void)
+{
+	sorting_network_generation_test();
+
+	std::mt19937 engine(26);
+	sorting_network_runtime_test<2>(engine);
+	sorting_network_lanes_test<2>(engine);
+	sorting_network_runtime_test<4>(engine);
+	sorting_network_lanes_test<4>(engine);
+	sorting_network_runtime_test<5>(engine);
+	sorting_network_lanes_test<5>(engine);
+	sorting_network_runtime_test<13>(engine);
+	sorting_network_lanes_test<13>(engine);
+	sorting_network_runtime_test<16>(engine);
+	sorting_network_lanes_test<16>(engine);
+	sorting_network_runtime_test<24>(engine);
+	sorting_network_lanes_test<24>(engine);
+	sorting_network_runtime_test<32>(engine);
+	sorting_network_lanes_test<32>(engine);
+}
+
+#endif	//	_SIGMA_API_META_TESTING_SORTING_NETWORK_TEST_HPP_
\ No newline at end of file
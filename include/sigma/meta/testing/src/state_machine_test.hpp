@@ -0,0 +1,129 @@
+#ifndef		_SIGMA_API_META_TESTING_STATE_MACHINE_TEST_HPP_
+#define		_SIGMA_API_META_TESTING_STATE_MACHINE_TEST_HPP_
+
+#include <cassert>
+#include <cstddef>
+
+#include <sigma/meta/algorithm/state_machine.hpp>
+
+using namespace sigma::meta;
+
+namespace state_machine_test
+{
+	struct New {};
+	struct Open {};
+	struct Partial {};
+	struct Filled {};
+	struct Cancelled {};
+
+	struct Ack {};
+	struct Fill { std::size_t quantity; };
+	struct Cancel {};
+
+	struct Order
+	{
+		std::size_t filled = 0;
+		std::size_t acks = 0;
+		bool cancelled = false;
+	};
+
+	struct Accumulate { void operator () (Order & order, const Fill & fill) const { order.filled += fill.quantity; } };
+	struct Acknowledge { void operator () (Order & order) const { ++order.acks; } };
+	struct Abort { void operator () (Order & order) const { order.cancelled = true; } };
+
+	using machine_t = StateMachine<
+		TVector<New, Open, Partial, Filled, Cancelled>,
+		TVector<Ack, Fill, Cancel>,
+		TVector<
+			Transition<New, Ack, Open, Acknowledge>,
+			Transition<New, Cancel, Cancelled, Abort>,
+			Transition<Open, Fill, Partial, Accumulate>,
+			Transition<Open, Cancel, Cancelled, Abort>,
+			Transition<Partial, Fill, Partial, Accumulate>,
+			Transition<Partial, Ack, Filled>,
+			Transition<Partial, Cancel, Cancelled, Abort>>,
+		Order>;
+}
+
+// compile time validation and tables
+void state_machine_static_test(void)
+{
+	using namespace state_machine_test;
+
+	//	Test ids and the accepted pairs
+
+	static_assert(machine_t::state_count == 5 && machine_t::event_count == 3);
+	static_assert(machine_t::state_id(type_c<Filled>) == 3);
+	static_assert(machine_t::event_id(type_c<Cancel>) == 2);
+	static_assert(machine_t::accepts(0, 0) && !machine_t::accepts(0, 1));
+	static_assert(!machine_t::accepts(3, 0) && !machine_t::accepts(4, 2));
+
+	//	Test the validations on transition arrays
+
+	constexpr std::size_t froms[] = { 0, 0, 1 };
+	constexpr std::size_t events[] = { 0, 1, 0 };
+	constexpr std::size_t tos[] = { 1, 2, 0 };
+	constexpr std::size_t repeated[] = { 0, 0, 0 };
+
+	static_assert(detail::is_deterministic(froms, events, 3));
+	static_assert(!detail::is_deterministic(froms, repeated, 3));
+	static_assert(detail::is_reachable<3>(froms, tos, 3));
+	static_assert(!detail::is_reachable<4>(froms, tos, 3));
+	static_assert(!detail::is_reachable<3>(froms, tos, 1));
+}
+
+// dispatch runs the actions and follows the transitions
+void state_machine_process_test(void)
+{
+	using namespace state_machine_test;
+
+	machine_t machine;
+	assert(machine.is<New>());
+
+	//	Test unhandled events leave state and context unchanged
+
+	machine.process(Fill{ 10 });
+	assert(machine.is<New>() && machine.context().filled == 0);
+
+	machine.process(Ack{});
+	assert(machine.is<Open>() && machine.context().acks == 1);
+
+	machine.process(Fill{ 10 });
+	machine.process(Fill{ 5 });
+	assert(machine.is(type_c<Partial>) && machine.context().filled == 15);
+
+	machine.process(Ack{});
+	assert(machine.is<Filled>() && machine.context().acks == 1);
+
+	machine.process(Cancel{});
+	assert(machine.is<Filled>() && !machine.context().cancelled);
+
+	//	Test events chosen at run time
+
+	machine.reset();
+	assert(!machine.process_id(machine_t::event_count));
+	assert(!machine.process_id(~std::size_t{ 0 }));
+	assert(machine.is<New>() && machine.context().acks == 1);
+
+	assert(machine.process_id(machine_t::event_id(type_c<Cancel>)));
+	assert(machine.is<Cancelled>() && machine.context().cancelled);
+
+	//	Test a context held by reference
+
+	Order order;
+	StateMachine<TVector<New, Open>, TVector<Ack>, TVector<Transition<New, Ack, Open, Acknowledge>>, Order &>
+		borrowed(order);
+
+	borrowed.process(Ack{});
+	borrowed.process(Ack{});
+	assert(borrowed.is<Open>() && order.acks == 1);
+	assert(&borrowed.context() == &order);
+}
+
+void state_machine_test_main(void)
+{
+	state_machine_static_test();
+	state_machine_process_test();
+}
+
+#endif	//	_SIGMA_API_META_TESTING_STATE_MACHINE_TEST_HPP_
\ No newline at end of file
@@ -0,0 +1,165 @@
+#ifndef		_SIGMA_API_META_TESTING_STRING_TEST_HPP_
+#define		_SIGMA_API_META_TESTING_STRING_TEST_HPP_
+
+#include <array>
+#include <cassert>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <sigma/meta/container/string.hpp>
+#include <sigma/meta/algorithm/string_switch.hpp>
+
+using namespace sigma::meta;
+
+namespace string_test
+{
+	//	"k" followed by the decimal digits of index_, keys for large switches
+	template <std::size_t index_>
+	struct NumberedKey
+	{
+		static constexpr std::size_t length(void)
+		{
+			std::size_t digits = 1;
+			for (std::size_t rest = index_; rest >= 10; rest /= 10) ++digits;
+			return digits + 1;
+		}
+
+		static constexpr std::array<char, length()> text(void)
+		{
+			std::array<char, length()> text{};
+			text[0] = 'k';
+			std::size_t rest = index_;
+			for (std::size_t position = length() - 1; position != 0; --position, rest /= 10)
+				text[position] = static_cast<char>('0' + rest % 10);
+			return text;
+		}
+
+		static constexpr std::array<char, length()> text_ = text();
+
+		static constexpr std::string_view view(void) { return { text_.data(), text_.size() }; }
+	};
+
+	template <std::size_t... indices_>
+	constexpr auto numbered_switch(std::index_sequence<indices_...>) { return StringSwitch<NumberedKey<indices_>...>{}; }
+}
+
+// String and literal tests
+void string_literal_test(void)
+{
+	auto s1 = ""_s;
+	auto s2 = "a"_s;
+	auto s3 = "order"_s;
+
+	//	Test types and sizes
+
+	static_assert(std::is_same_v<decltype(s1), String<>>);
+	static_assert(std::is_same_v<decltype(s3), String<'o', 'r', 'd', 'e', 'r'>>);
+	static_assert(s1.size() == 0);
+	static_assert(s2.size() == 1);
+	static_assert(s3.size() == 5);
+
+	//	Test access
+
+	static_assert(s3.get<1>() == 'r');
+	static_assert(s3[4_u] == 'r');
+	static_assert(s3.front() == 'o');
+	static_assert(s3.back() == 'r');
+	static_assert(s3.view() == "order");
+	static_assert(std::string_view(s2) == "a");
+	static_assert(s3.c_str()[5] == '\0');
+
+	//	Test equality operator
+
+	static_assert(s1 == ""_s);
+	static_assert(s3 == "order"_s);
+	static_assert(s2 != s3);
+	static_assert(s3 != "orders"_s);
+}
+
+// compile time perfect hash tests
+void string_switch_test(void)
+{
+	//	Test lookups
+	{
+		constexpr auto keywords = string_switch("new"_s, "cancel"_s, "replace"_s, "fill"_s, ""_s);
+
+		static_assert(keywords.size() == 5);
+		static_assert(keywords.find("new") == 0);
+		static_assert(keywords.find("cancel") == 1);
+		static_assert(keywords.find("replace") == 2);
+		static_assert(keywords.find("fill") == 3);
+		static_assert(keywords.find("") == 4);
+		static_assert(keywords.find("fil") == keywords.npos);
+		static_assert(keywords.find("cancelled") == keywords.npos);
+		static_assert(!keywords.contains("NEW"));
+	}
+
+	//	Test keys only separable by a full hash
+	{
+		constexpr auto keywords = string_switch(TVector<
+			decltype("abxd"_s), decltype("abyd"_s), decltype("azxd"_s), decltype("azyd"_s)>{});
+
+		static_assert(keywords.find("abxd") == 0);
+		static_assert(keywords.find("abyd") == 1);
+		static_assert(keywords.find("azxd") == 2);
+		static_assert(keywords.find("azyd") == 3);
+		static_assert(keywords.find("aaad") == keywords.npos);
+	}
+
+	//	Test key sets past the direct hash
+	{
+		constexpr auto keywords = string_test::numbered_switch(std::make_index_sequence<1000>{});
+
+		static_assert(keywords.find("k0") == 0 && keywords.find("k999") == 999);
+		static_assert(keywords.find("k1000") == keywords.npos && keywords.find("") == keywords.npos);
+
+		for (std::size_t index = 0; index < keywords.size(); ++index)
+			assert(keywords.find("k" + std::to_string(index)) == index);
+	}
+}
+
+// runtime dispatch tests
+void string_dispatch_test(void)
+{
+	constexpr auto keywords = string_switch("add"_s, "sub"_s, "neg"_s);
+
+	auto dispatch = make_dispatch(keywords,
+		[](int, int) { return -1; },
+		[](int lhs, int rhs) { return lhs + rhs; },
+		[](int lhs, int rhs) { return lhs - rhs; },
+		[](int lhs, int) { return -lhs; });
+
+	const std::string sub = "sub";
+
+	assert(dispatch("add", 3, 4) == 7);
+	assert(dispatch(sub, 7, 3) == 4);
+	assert(dispatch("neg", 3, 4) == -3);
+
+	//	Test unknown keys reach the fallback
+
+	assert(dispatch("mul", 3, 4) == -1);
+	assert(dispatch("", 3, 4) == -1);
+
+	int calls = 0;
+	auto counting = make_dispatch(string_switch("x"_s),
+		[](int & target) { target -= 1; },
+		[&calls](int & target) { target += 1; ++calls; });
+
+	int target = 0;
+	counting("x", target);
+	counting("y", target);
+	counting("x", target);
+
+	assert(target == 1);
+	assert(calls == 2);
+}
+
+void string_test_main(void)
+{
+	string_literal_test();
+	string_switch_test();
+	string_dispatch_test();
+}
+
+#endif	//	_SIGMA_API_META_TESTING_STRING_TEST_HPP_
\ No newline at end of file
@@ -0,0 +1,101 @@
+#ifndef		_SIGMA_API_META_TESTING_TYPE_MAP_TEST_HPP_
+#define		_SIGMA_API_META_TESTING_TYPE_MAP_TEST_HPP_
+
+#include <cassert>
+#include <cstddef>
+#include <string>
+
+#include <sigma/meta/container/type_map.hpp>
+
+using namespace sigma::meta;
+
+// compile time id tests
+void type_id_test(void)
+{
+	struct Order {};
+	struct Fill {};
+	struct Cancel {};
+
+	using events_t = TVector<Order, Fill, Cancel>;
+
+	//	Test ids are dense positions
+
+	static_assert(type_id<Order>(events_t{}) == 0);
+	static_assert(type_id<Fill>(events_t{}) == 1);
+	static_assert(type_id<Cancel>(events_t{}) == 2);
+	static_assert(type_id(events_t{}, type_c<Cancel>) == 2);
+
+	//	Test distinct cv and reference types are distinct keys
+
+	static_assert(type_id<const int>(TVector<int, const int, int &>{}) == 1);
+	static_assert(type_id<int &>(TVector<int, const int, int &>{}) == 2);
+
+	static_assert(contains(events_t{}, type_c<Fill>));
+	static_assert(!contains(events_t{}, type_c<int>));
+	static_assert(!contains(TVector<>{}, type_c<int>));
+
+	static_assert(detail::has_duplicate_types<int, char, int>());
+	static_assert(!detail::has_duplicate_types<int, char, const int>());
+}
+
+// array backed map tests
+void type_map_test(void)
+{
+	using keys_t = TVector<int, double, std::string>;
+
+	//	Test constant evaluation
+
+	{
+		constexpr auto counts = [] {
+			auto result = type_map<std::size_t>(keys_t{});
+			result[type_c<int>] = 3;
+			result.get<std::string>() += 2;
+			return result;
+		}();
+
+		static_assert(counts.size() == 3);
+		static_assert(counts.get<int>() == 3);
+		static_assert(counts[type_c<double>] == 0);
+		static_assert(counts.at(TypeMap<keys_t, std::size_t>::id(type_c<std::string>)) == 2);
+	}
+
+	//	Test layout is the plain array
+
+	static_assert(sizeof(TypeMap<keys_t, int>) == 3 * sizeof(int));
+
+	//	Test runtime access and iteration in id order
+
+	{
+		auto names = type_map(keys_t{}, std::string("?"));
+		names.get<int>() = "int";
+		names[type_c<double>] = "double";
+
+		assert(names.at(type_id<double>(keys_t{})) == "double");
+		assert(names.get<std::string>() == "?");
+
+		std::string joined;
+		std::size_t visited = 0;
+		names.for_each([&](auto key, const std::string & name)
+		{
+			assert(type_id(keys_t{}, key) == visited++);
+			joined += name;
+		});
+		assert(joined == "intdouble?");
+
+		for (auto & name : names) name += "!";
+		assert(names.get<int>() == "int!" && names.get<std::string>() == "?!");
+
+		auto copy = names;
+		assert(copy == names);
+		copy.get<double>().clear();
+		assert(copy != names);
+	}
+}
+
+void type_map_test_main(void)
+{
+	type_id_test();
+	type_map_test();
+}
+
+#endif	//	_SIGMA_API_META_TESTING_TYPE_MAP_TEST_HPP_
\ No newline at end of file